@@ -56,6 +56,102 @@
                                                          policies::policy<>());
   }
 
+  // Return a read-only view of B2n for n in [start_index, start_index + number_of_bernoullis_b2n),
+  // referring directly to the values held in the Bernoulli number cache, which are computed first
+  // if need be. The view remains valid for the lifetime of the program, and reading it takes no locks
+  // and makes no copies. For a type whose precision is set at run time, the view refers to the cache
+  // for the current precision, which is then never released.
+  template <class T, class Policy>
+  inline boost::iterator_range<const T*> bernoulli_b2n_view(int start_index,
+                                                            unsigned number_of_bernoullis_b2n,
+                                                            const Policy& pol)
+  {
+    return boost::math::detail::bernoulli_view_imp<T, Policy>(start_index, number_of_bernoullis_b2n, pol);
+  }
+
+  template <class T>
+  inline boost::iterator_range<const T*> bernoulli_b2n_view(int start_index,
+                                                            unsigned number_of_bernoullis_b2n)
+  {
+    return boost::math::bernoulli_b2n_view<T>(start_index, number_of_bernoullis_b2n, policies::policy<>());
+  }
+
+  // Back the Bernoulli number cache for T with the file filename, so that values computed by one
+  // process need not be computed again by those that follow. Entries saved there earlier for the same
+  // type and precision are loaded into the cache, and entries computed from now on are appended.
+  // Returns the number of entries loaded. Each line of the file carries a checksum: lines that
+  // were torn or interleaved by concurrent writers, or damaged since, are ignored, and loading
+  // stops at the first index for which no valid line remains. Failures to read or write the file
+  // are not reported.
+  template <class T>
+  inline std::size_t bernoulli_b2n_cache_file(const char* filename)
+  {
+    return boost::math::detail::get_bernoulli_numbers_cache<T>().attach_file(filename);
+  }
+
+  // Compute and cache B2n for all n in [0, max_index] now, so that later calls for these indices,
+  // from any thread, only read the cache. To have this done before main() for every type whose
+  // Bernoulli numbers the program uses, define BOOST_MATH_BERNOULLI_INITIALIZER_MAX_INDEX instead.
+  template <class T, class Policy>
+  inline void bernoulli_b2n_reserve(const int max_index, const Policy& pol)
+  {
+    boost::math::detail::bernoulli_reserve_imp<T>(max_index, 1U, pol);
+  }
+
+  template <class T>
+  inline void bernoulli_b2n_reserve(const int max_index)
+  {
+    boost::math::bernoulli_b2n_reserve<T>(max_index, policies::policy<>());
+  }
+
+  // As bernoulli_b2n_reserve, but spreading the tangent number recurrence
+  // over thread_count threads (zero selects the number of hardware threads).
+  // Without standard library thread support, or for indices at which
+  // overflow is possible, the work is done in the calling thread.
+  template <class T, class Policy>
+  inline void bernoulli_b2n_parallel_reserve(const int max_index, const unsigned thread_count, const Policy& pol)
+  {
+    boost::math::detail::bernoulli_reserve_imp<T>(max_index, thread_count, pol);
+  }
+
+  template <class T>
+  inline void bernoulli_b2n_parallel_reserve(const int max_index, const unsigned thread_count)
+  {
+    boost::math::bernoulli_b2n_parallel_reserve<T>(max_index, thread_count, policies::policy<>());
+  }
+
+  // Return the largest n for which bernoulli_b2n<T>(n) is finite. For the builtin types this is
+  // exact; for other types it is estimated from the exponent range of T and may be one too large.
+  template <class T>
+  inline std::size_t bernoulli_b2n_max_index()
+  {
+    return boost::math::detail::bernoulli_max_finite_index<T>();
+  }
+
+  // Release the Bernoulli number caches of the types whose precision is set at run time, such as
+  // mpfr_float; those of types with a fixed precision are bounded by the range of the type, and are
+  // kept. A cache that another thread is using is released once that thread next asks for Bernoulli
+  // numbers of the same type, and one that is shared by a longer lived object, such as the state of
+  // the range overloads of polygamma, once that object is destroyed. Caches that views refer to are
+  // never released. Cache files attached earlier no longer apply to the caches, which are rebuilt on
+  // demand. Without thread_local support nothing is released, since there is then no telling
+  // whether another thread is still reading a cache.
+  inline void bernoulli_b2n_release_caches()
+  {
+    boost::math::detail::get_bernoulli_cache_manager().release_all();
+  }
+
+  // Set the number of bytes that the Bernoulli number caches of all the types whose precision is set
+  // at run time may hold together, BOOST_MATH_BERNOULLI_CACHE_BYTES by default, and return the
+  // previous budget. Whenever a thread moves to another cache, the least recently used caches that
+  // no thread is using are released until the total is within the budget. The caches of a single
+  // type are further limited to BOOST_MATH_BERNOULLI_PRECISION_CACHE_BYTES. Without thread_local
+  // support nothing is released.
+  inline std::size_t bernoulli_b2n_set_cache_budget(const std::size_t bytes)
+  {
+    return boost::math::detail::get_bernoulli_cache_manager().set_budget(bytes);
+  }
+
 
 
 } } // namespace boost::math
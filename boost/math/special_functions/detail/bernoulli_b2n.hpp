@@ -11,21 +11,73 @@
 #ifndef _BOOST_BERNOULLI_B2N_2013_05_30_HPP_
  #define _BOOST_BERNOULLI_B2N_2013_05_30_HPP_
 
+  #include <algorithm>
+  #include <climits>
+  #include <fstream>
+  #include <iomanip>
+  #include <iterator>
   #include <limits>
+  #include <locale>
+  #include <sstream>
+  #include <string>
   #include <vector>
   #include <cmath>
+  #include <boost/array.hpp>
+  #include <boost/config.hpp>
   #include <boost/cstdint.hpp>
+  #include <boost/noncopyable.hpp>
+  #include <boost/range/iterator_range.hpp>
+  #include <boost/scoped_array.hpp>
+  #include <boost/shared_ptr.hpp>
+  #include <boost/detail/lightweight_mutex.hpp>
+  #include <boost/lexical_cast.hpp>
   #include <boost/math/special_functions/pow.hpp>
+  #include <boost/math/special_functions/fpclassify.hpp>
+  #include <boost/math/special_functions/trunc.hpp>
+  #include <boost/math/tools/precision.hpp>
+  #include <boost/math/tools/big_constant.hpp>
   #include <boost/math/policies/policy.hpp>
   #include <boost/math/policies/error_handling.hpp>
   #include <boost/static_assert.hpp>
+  #include <boost/mpl/bool.hpp>
   #include <boost/mpl/if.hpp>
   #include <boost/mpl/int.hpp>
   #include <boost/type_traits/is_convertible.hpp>
-  #include <boost/multiprecision/cpp_dec_float.hpp>
+  #include <boost/type_traits/is_floating_point.hpp>
+  #include <boost/type_traits/is_same.hpp>
   #include <boost/math/constants/constants.hpp>
+  #include <boost/math/special_functions/detail/bernoulli_b2n_rational_data.hpp>
+  #include <boost/math/tools/config.hpp>
+
+  #ifdef BOOST_MATH_BERNOULLI_EXACT_TANGENT_NUMBERS
+    #include <boost/multiprecision/cpp_int.hpp>
+  #endif
+
+  #if defined(BOOST_HAS_THREADS) && !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+    #include <atomic>
+    #define BOOST_MATH_BERNOULLI_ATOMIC_NS std
+  #elif defined(BOOST_HAS_THREADS)
+    #include <boost/atomic.hpp>
+    #define BOOST_MATH_BERNOULLI_ATOMIC_NS boost
+  #endif
+
+  #if defined(BOOST_HAS_THREADS) && !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_THREAD)
+    #include <thread>
+    #define BOOST_MATH_BERNOULLI_HAS_PARALLEL_TANGENT_NUMBERS
+  #endif
+
+  #if defined(BOOST_HAS_THREADS) && !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+    #define BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+  #endif
+
+  #ifndef BOOST_MATH_BERNOULLI_PRECISION_CACHE_BYTES
+    #define BOOST_MATH_BERNOULLI_PRECISION_CACHE_BYTES (32UL * 1024UL * 1024UL)
+  #endif
+
+  #ifndef BOOST_MATH_BERNOULLI_CACHE_BYTES
+    #define BOOST_MATH_BERNOULLI_CACHE_BYTES (256UL * 1024UL * 1024UL)
+  #endif
 
-  using namespace boost::multiprecision;
   using std::size_t;
 
   struct pol{};
@@ -139,54 +191,36 @@
     return lower_limit;
   }
 
+  // The tangent number index from which overflow checks are needed, found
+  // once per type by the search above (see also bernoulli_initializer).
+  template <class T>
+  inline std::size_t tangent_numbers_min_overflow_index()
+  {
+    static const std::size_t index = static_cast<std::size_t>(possible_overflow_index<T>());
+
+    return index;
+  }
+
+  template <class T>
+  struct bernoulli_imp_variant;
+
   template <class T>
   struct max_bernoulli_index;
 
   template<class T>
-  inline T unchecked_bernoulli_b2n(size_t n);
+  BOOST_CXX14_CONSTEXPR T unchecked_bernoulli_b2n(size_t n);
+
+  template <class T>
+  class tangent_numbers_generator;
 
+  // Write T_0 ... T_m to tangent_numbers, raising an overflow error for
+  // those that overflow T, see tangent_numbers_generator below.
   template<class T,class TypeIterator,class Policy>
-  inline void tangent(TypeIterator tangent_numbers,const int &m, T , Policy&)
+  inline void tangent(TypeIterator tangent_numbers,const int &m, T , Policy& pol)
   {
-    // TBD: Initialize this before main().
-    static size_t min_overflow_index = static_cast<size_t>(possible_overflow_index<T>());
-
-    tangent_numbers[0U] = T(0U);
-    tangent_numbers[1U] = T(1U);
+    tangent_numbers_generator<T> generator;
 
-    for(size_t k = 2U; k <= size_t(m); k++)
-    {
-      if(   (k >= min_overflow_index)
-         && (boost::math::tools::max_value<T>()/(k - 1) < tangent_numbers[k - 1])
-        )
-      {
-        tangent_numbers[k]=policies::raise_overflow_error<T>("boost::math::bernoulli<%1%>", "Overflow error while calculating tangent number %1%", T(k),Policy());
-      }
-      else
-      {
-        tangent_numbers[k] = (T(k - 1)) * tangent_numbers[k - 1];
-      }
-    }
-
-    for(size_t k = 2; k <= size_t(m); k++)
-    {
-      for(size_t j = k; j <= size_t(m); j++)
-      {
-        if(   (j >= min_overflow_index)
-           && (   (boost::math::tools::max_value<T>() / (j - k) < tangent_numbers[j - 1])
-               || (boost::math::tools::max_value<T>() / (j - k + 2) < tangent_numbers[j])
-               || (boost::math::tools::max_value<T>() - tangent_numbers[j - 1] * (j - k) < tangent_numbers[j] * (j - k + 2))
-               || ((boost::math::isinf)(tangent_numbers[j])))
-          )
-        {
-          tangent_numbers[j] = policies::raise_overflow_error<T>("boost::math::bernoulli<%1%>", "Overflow error while calculating tangent number %1%", T(j),Policy());
-        }
-        else
-        {
-          tangent_numbers[j] = (tangent_numbers[j - 1] * (j - k)) + (tangent_numbers[j] * (j - k + 2));
-        }
-      }
-    }
+    generator.generate(0U, static_cast<std::size_t>(m) + 1U, tangent_numbers, pol);
   }
 
   template <class T, class Policy>
@@ -214,428 +248,4150 @@
     return (((nn % 4) == 0) ? -x : x);
   }
 
-  template <class T, class Policy>
-  void tangent_numbers_series(std::vector<T>& bn, const size_t start_index, const size_t number_of_bernoullis_bn, Policy &pol)
+  // A value that is written by one thread and published to others with
+  // release/acquire semantics. When threads are disabled this is a plain value.
+  template <class U>
+  class bernoulli_atomic
   {
-    const size_t m = start_index + number_of_bernoullis_bn;
+  public:
+    explicit bernoulli_atomic(U u = U()) : m_value(u) { }
 
-    std::vector<T> tangent_numbers(m + 1U);
+  #ifdef BOOST_MATH_BERNOULLI_ATOMIC_NS
+    U    acquire_load() const   { return m_value.load(BOOST_MATH_BERNOULLI_ATOMIC_NS::memory_order_acquire); }
+    void release_store(U u)     { m_value.store(u, BOOST_MATH_BERNOULLI_ATOMIC_NS::memory_order_release); }
 
-    const int mn = static_cast<int>(m);
-    boost::math::detail::tangent(tangent_numbers.begin(), mn, T(1), pol);
+  private:
+    BOOST_MATH_BERNOULLI_ATOMIC_NS::atomic<U> m_value;
+  #else
+    U    acquire_load() const   { return m_value; }
+    void release_store(U u)     { m_value = u; }
 
-    T power_two(1);
+  private:
+    U m_value;
+  #endif
+  };
 
-    power_two = ldexp(T(1), 2 * static_cast<boost::int32_t>(start_index));
+  #ifdef BOOST_MATH_BERNOULLI_HAS_PARALLEL_TANGENT_NUMBERS
 
-    bn.clear();
-    bn.resize(number_of_bernoullis_bn);
+  // Advances the row of the tangent number triangle kept by
+  // tangent_numbers_generator (below) through the rows [first, last) on
+  // several threads. Element j of row i depends on element j of row i - 1
+  // and on element j - 1 of row i, so the columns are split into blocks,
+  // one per thread, and each block processes row i as soon as the block to
+  // its left has finished it: the threads sweep down the triangle as a
+  // wavefront. The element at the boundary between two blocks is handed
+  // over through a small ring buffer, which also bounds how far a block may
+  // run ahead of its right neighbour.
+  //
+  // No overflow checks are made, so last must not exceed the index
+  // from which the tangent numbers might overflow T.
+  template <class T>
+  class tangent_numbers_wavefront : private boost::noncopyable
+  {
+  public:
+    BOOST_STATIC_CONSTANT(std::size_t, ring_size = 64U);
 
-    for(size_t i = 0; i < number_of_bernoullis_bn; i++)
+    // The number of blocks worth using for the rows [first, last): each
+    // must own enough columns to amortize the hand-over between threads.
+    // A thread_count of zero selects the number of hardware threads.
+    static unsigned block_count(const std::size_t first, const std::size_t last, unsigned thread_count)
     {
-      T b((T(i + start_index) * 2));
-
-      b  = b / (power_two * (power_two - 1));
-      b *= tangent_numbers[i+start_index];
+      static const std::size_t min_columns = 32U;
 
-      power_two *= 4;
+      if(thread_count == 0U)
+      {
+        thread_count = std::thread::hardware_concurrency();
+      }
 
-      const bool b_neg = (static_cast<boost::int32_t>((i + start_index) % static_cast<boost::int32_t>(2)) == static_cast<boost::int32_t>(0));
+      if(last < first + min_columns)
+      {
+        return 1U;
+      }
 
-      bn[i] = ((!b_neg) ? b : -b);
+      return static_cast<unsigned>((std::min)(static_cast<std::size_t>(thread_count), (last - 1U) / min_columns));
     }
-  }
-
-  template <class T, class OutputIterator, class Policy>
-  inline OutputIterator cache_imp(size_t start_index,
-                                      size_t number_of_bernoullis_bn,
-                                      OutputIterator out_it,
-                                      const Policy& pol)
-  {
 
-    if((start_index + number_of_bernoullis_bn - 1) <= max_bernoulli_index<T>::value)
+    // Row first - 1 is held in row[0 ... first - 1], and row must have room
+    // for last elements, those beyond first - 1 being zero. T_i is written to
+    // output[i - output_first] for each i in [output_first, last).
+    tangent_numbers_wavefront(T*                row,
+                              const std::size_t first,
+                              const std::size_t last,
+                              T*                output,
+                              const std::size_t output_first,
+                              const unsigned    blocks) : m_row         (row),
+                                                          m_first       (first),
+                                                          m_last        (last),
+                                                          m_output      (output),
+                                                          m_output_first(output_first),
+                                                          m_blocks      (blocks),
+                                                          m_bounds      (blocks + 1U),
+                                                          m_progress    (new bernoulli_atomic<std::size_t>[blocks]),
+                                                          m_edges       (blocks * ring_size),
+                                                          m_failed      (false)
     {
-      OutputIterator last= out_it + number_of_bernoullis_bn;
+      // Split the columns [1, last) into blocks of about equal work:
+      // column j takes part in the rows max(first, j) ... last - 1.
+      boost::uintmax_t total = 0U;
 
-      while(out_it!=last)
+      for(std::size_t j = 1U; j < last; ++j)
       {
-        *out_it = unchecked_bernoulli_b2n<T>(start_index);
-        ++out_it;
-        ++start_index;
+        total += last - (std::max)(first, j);
       }
 
-      //return one past the last element
-      return out_it;
+      boost::uintmax_t work = 0U;
+      std::size_t      j    = 1U;
+
+      m_bounds[0U] = 1U;
+
+      for(unsigned b = 1U; b < blocks; ++b)
+      {
+        const boost::uintmax_t target = (total / blocks) * b;
+
+        while((work < target) && (j < last))
+        {
+          work += last - (std::max)(first, j);
+          ++j;
+        }
+
+        // Every block owns at least two columns.
+        m_bounds[b] = (std::min)((std::max)(j, m_bounds[b - 1U] + 2U), last - 2U * (blocks - b));
+      }
+
+      m_bounds[blocks] = last;
+
+      for(unsigned b = 0U; b < blocks; ++b)
+      {
+        // A block takes no part in the rows before its first column.
+        m_progress[b].release_store((std::max)(first, m_bounds[b]));
+      }
     }
-    else if(   ( start_index <= static_cast<boost::int32_t>(max_bernoulli_index<T>::value))
-            && ((start_index + number_of_bernoullis_bn) > static_cast<boost::int32_t>(max_bernoulli_index<T>::value))
-           )
+
+    // Returns false if a thread could not be started or a block raised an
+    // exception, in which case the row is left in an unspecified state.
+    bool run()
     {
-      out_it=cache_imp<T,OutputIterator,Policy>(start_index,max_bernoulli_index<T>::value - start_index +1, out_it,pol);
+      std::vector<std::thread> threads;
 
-      out_it=cache_imp<T,OutputIterator,Policy>(max_bernoulli_index<T>::value+1,
-                                                number_of_bernoullis_bn - max_bernoulli_index<T>::value + start_index -1,
-                                                out_it,
-                                                pol);
-      return out_it;
-    }
+      try
+      {
+        threads.reserve(m_blocks - 1U);
 
-    std::vector<T> bn;
+        for(unsigned b = 1U; b < m_blocks; ++b)
+        {
+          threads.push_back(std::thread(&tangent_numbers_wavefront::sweep, this, b));
+        }
+      }
+      catch(...)
+      {
+        m_failed.release_store(true);
+      }
 
-    tangent_numbers_series(bn, start_index , number_of_bernoullis_bn, pol);
+      sweep(0U);
 
-    OutputIterator last = out_it + number_of_bernoullis_bn;
+      for(std::size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
 
-    size_t i = 0U;
+      return (!m_failed.acquire_load());
+    }
 
-    while(out_it != last)
+  private:
+    void sweep(const unsigned b)
     {
-      *out_it = bn[i];
-      ++out_it;
-      ++i;
+      try
+      {
+        sweep_block(b);
+      }
+      catch(...)
+      {
+        m_failed.release_store(true);
+      }
     }
 
-    return out_it;
-  }
+    void sweep_block(const unsigned b)
+    {
+      const std::size_t lo = m_bounds[b];
+      const std::size_t hi = m_bounds[b + 1U];
 
-  template <class T, class Policy>
-  T bernoulli_number_imp(const int n, const Policy &pol)
-  {
-    if(n < 0)
+      T left(0U);
+
+      for(std::size_t i = (std::max)(m_first, lo); i < m_last; ++i)
+      {
+        std::size_t j = lo;
+
+        if(b == 0U)
+        {
+          m_row[1U] *= (i - 1);
+          left = m_row[1U];
+          j    = 2U;
+        }
+        else
+        {
+          if(!wait_for(m_progress[b - 1U], i + 1U))
+          {
+            return;
+          }
+
+          left = m_edges[(b * ring_size) + (i % ring_size)];
+        }
+
+        // Row i only involves the columns 1 ... i.
+        const std::size_t end = (std::min)(hi, i + 1U);
+
+        for( ; j < end; ++j)
+        {
+          m_row[j] = (m_row[j] * (i - j)) + (left * (i - j + 2));
+          left     = m_row[j];
+        }
+
+        if((end == i + 1U) && (i >= m_output_first))
+        {
+          m_output[i - m_output_first] = m_row[i];
+        }
+
+        if((b + 1U < m_blocks) && (i >= hi))
+        {
+          // Hand m_row[hi - 1] over to the next block, once it has
+          // consumed the entry of the ring buffer that this overwrites.
+          if(!wait_for(m_progress[b + 1U], (i + 1U > ring_size) ? (i + 1U - ring_size) : 0U))
+          {
+            return;
+          }
+
+          m_edges[((b + 1U) * ring_size) + (i % ring_size)] = left;
+        }
+
+        m_progress[b].release_store(i + 1U);
+      }
+    }
+
+    bool wait_for(const bernoulli_atomic<std::size_t>& progress, const std::size_t value) const
     {
-      policies::raise_domain_error<T>("boost::math::bernoulli<%1%>", "Index should be >= 0 but got %1%", T(n/2), Policy());
+      while(progress.acquire_load() < value)
+      {
+        if(m_failed.acquire_load())
+        {
+          return false;
+        }
+
+        std::this_thread::yield();
+      }
+
+      return true;
     }
 
-    static std::vector<T> cache_table;
-    std::size_t previous_cache_size = cache_table.size();
-    std::size_t index = n / 2;
+    T* const                                           m_row;
+    const std::size_t                                  m_first;
+    const std::size_t                                  m_last;
+    T* const                                           m_output;
+    const std::size_t                                  m_output_first;
+    const unsigned                                     m_blocks;
+    std::vector<std::size_t>                           m_bounds;
+    boost::scoped_array<bernoulli_atomic<std::size_t> > m_progress;
+    std::vector<T>                                     m_edges;
+    bernoulli_atomic<bool>                             m_failed;
+  };
+
+  #endif // BOOST_MATH_BERNOULLI_HAS_PARALLEL_TANGENT_NUMBERS
+
+  // Resumable generator of the tangent numbers T_n.
+  //
+  // This evaluates the triangle of Brent and Zimmermann row by row:
+  // generating T_n only needs the row of the triangle that produced T_(n-1),
+  // so the row is kept as the generator state and extending the sequence
+  // from N to M terms costs O(M^2 - N^2) operations rather than O(M^2).
+  template <class T>
+  class tangent_numbers_generator
+  {
+  public:
+    tangent_numbers_generator() : m_size(0U), m_overflow(false), m_busy(false) { }
+
+    // The number of tangent numbers generated so far, T_0 ... T_(size() - 1).
+    std::size_t size() const { return m_size; }
 
-    if( previous_cache_size <= index)
+    // Write T_n for n in [start, start + count) to out. Terms between size()
+    // and start are generated and discarded. Requests for terms that have
+    // already been passed restart the generator from T_0. If thread_count
+    // is not one, the rows of the triangle that can't overflow may be
+    // evaluated on that many threads (zero selects the number of hardware
+    // threads), see tangent_numbers_wavefront.
+    template <class OutputIterator, class Policy>
+    OutputIterator generate(const std::size_t start, const std::size_t count, OutputIterator out, const Policy& pol, const unsigned thread_count = 1U)
     {
-      cache_table.resize(index + 1);
+      if((start < m_size) || m_busy)
+      {
+        // Either we are asked to go back, or an exception escaped
+        // part way through a row, leaving it inconsistent.
+        m_row.clear();
+        m_size     = 0U;
+        m_overflow = false;
+      }
+
+  #ifdef BOOST_MATH_BERNOULLI_HAS_PARALLEL_TANGENT_NUMBERS
+      if(thread_count != 1U)
+      {
+        out = generate_parallel(start, (std::min)(start + count, tangent_numbers_min_overflow_index<T>()), out, pol, thread_count);
+      }
+  #else
+      static_cast<void>(thread_count);
+  #endif
+
+      if(!m_overflow)
+      {
+        // The row grows by one element per term: make room for them all
+        // at once rather than reallocating as it goes.
+        m_row.reserve(start + count);
+      }
+
+      while(m_size < start)
+      {
+        static_cast<void>(next(pol));
+      }
+
+      while(m_size < start + count)
+      {
+        *out = next(pol);
+        ++out;
+      }
 
-      cache_imp<T>(previous_cache_size,
-                   index - previous_cache_size + 1,
-                   cache_table.begin() + previous_cache_size,
-                   pol);
+      return out;
     }
-    return cache_table[index];
-  }
 
-  template <class T, class OutputIterator, class Policy>
-  inline OutputIterator bernoulli_series_imp(int start_index,
-                                             unsigned number_of_bernoullis_bn,
-                                             OutputIterator out_it,
-                                             const Policy& pol)
-  {
-    if(start_index < 0)
+  private:
+  #ifdef BOOST_MATH_BERNOULLI_HAS_PARALLEL_TANGENT_NUMBERS
+    // Advance the generator to last terms on several threads, if that is
+    // worthwhile, writing those with index start or more to out.
+    template <class OutputIterator, class Policy>
+    OutputIterator generate_parallel(const std::size_t start, const std::size_t last, OutputIterator out, const Policy& pol, const unsigned thread_count)
     {
-       policies::raise_domain_error<T>("boost::math::bernoulli<%1%>", "Start Index should be >= 0 but got %1%", T(start_index), Policy());
+      if(m_overflow || (tangent_numbers_wavefront<T>::block_count(m_size, last, thread_count) < 2U))
+      {
+        return out;
+      }
+
+      while(m_size < 2U)
+      {
+        const T t = next(pol);
+
+        if(m_size > start)
+        {
+          *out = t;
+          ++out;
+        }
+      }
+
+      const std::size_t first  = m_size;
+      const unsigned    blocks = tangent_numbers_wavefront<T>::block_count(first, last, thread_count);
+
+      if(blocks < 2U)
+      {
+        return out;
+      }
+
+      const std::size_t output_first = (std::max)(start, first);
+      const std::size_t output_count = ((last > output_first) ? (last - output_first) : 0U);
+
+      // The wavefront writes to the destination itself when that is
+      // a pointer, otherwise to a buffer that is copied afterwards.
+      std::vector<T> buffer;
+
+      T* output = direct_output(out);
+
+      if((output == 0) && (output_count != 0U))
+      {
+        buffer.resize(output_count);
+
+        output = &buffer[0U];
+      }
+
+      m_busy = true;
+      m_row.resize(last, T(0U));
+
+      tangent_numbers_wavefront<T> wavefront(&m_row[0U],
+                                             first,
+                                             last,
+                                             ((output_count != 0U) ? output : static_cast<T*>(0)),
+                                             output_first,
+                                             blocks);
+
+      if(!wavefront.run())
+      {
+        // Rebuild the row we started from and leave the rest to the
+        // serial code, which raises any error in the calling thread.
+        m_row.clear();
+        m_size = 0U;
+        m_busy = false;
+
+        while(m_size < first)
+        {
+          static_cast<void>(next(pol));
+        }
+
+        return out;
+      }
+
+      m_busy = false;
+      m_size = last;
+
+      if(buffer.empty())
+      {
+        return advance_output(out, output_count);
+      }
+
+      return std::copy(buffer.begin(), buffer.end(), out);
     }
 
-    // TBD: Some kind of initialization before main()?
-    static std::vector<T> cache_table;
+    static T* direct_output(T* out) { return out; }
+
+    template <class OutputIterator>
+    static T* direct_output(const OutputIterator&) { return static_cast<T*>(0); }
+
+    // Step past what the wavefront wrote to out itself: it only ever
+    // does so through a pointer, so other iterators are left as they are.
+    static T* advance_output(T* out, const std::size_t count) { return out + count; }
 
-    std::size_t previous_cache_size = cache_table.size();
-    std::size_t index = start_index + number_of_bernoullis_bn - 1;
+    template <class OutputIterator>
+    static OutputIterator advance_output(OutputIterator out, const std::size_t) { return out; }
+  #endif
 
-    if(previous_cache_size <= index)
+    template <class Policy>
+    T next(const Policy& pol)
     {
-      cache_table.resize(index + 1);
+      const std::size_t min_overflow_index = tangent_numbers_min_overflow_index<T>();
+
+      const std::size_t i = m_size;
+
+      if(i < 2U)
+      {
+        // T_0 = 0, T_1 = 1, and the first row of the triangle is (0, 1).
+        m_row.push_back(T(i));
+        ++m_size;
+        return T(i);
+      }
+
+      if(m_overflow)
+      {
+        return overflow(pol);
+      }
+
+      if((i < min_overflow_index) || row_cannot_overflow(i))
+      {
+        next_row_unchecked(i);
+      }
+      else if(!next_row_checked(i))
+      {
+        return overflow(pol);
+      }
 
-      cache_imp<T,OutputIterator,Policy>(static_cast<int>(previous_cache_size),
-                                         static_cast<unsigned int>(index - previous_cache_size + 1),
-                                         cache_table.begin() + previous_cache_size,
-                                         pol);
+      ++m_size;
+
+      return m_row[i];
     }
 
-    OutputIterator last= out_it + number_of_bernoullis_bn;
+    // Whether row i can be evaluated without overflow checks. The entries
+    // of a row increase towards its last, T_i, and each intermediate result
+    // is bounded by the entry it produces, so it is enough that T_i is
+    // finite. Since T_i = 2 (2i-1)! (2^(2i) - 1) zeta(2i) / pi^(2i), the
+    // ratio T_i / T_(i-1) is less than 3 i^2: one division per row.
+    bool row_cannot_overflow(const std::size_t i) const
+    {
+      return (m_row[i - 1U] < ((boost::math::tools::max_value<T>() / (3U * i)) / i));
+    }
 
-    while(out_it!=last)
+    void next_row_unchecked(const std::size_t i)
     {
-      *out_it = cache_table[start_index];
-      ++out_it;
-      ++start_index;
+      m_busy = true;
+
+      m_row[1U] *= (i - 1);
+      m_row.push_back(T(0U));
+
+      for(std::size_t j = 2U; j <= i; j++)
+      {
+        m_row[j] = (m_row[j] * (i - j)) + (m_row[j - 1] * (i - j + 2));
+      }
+
+      m_busy = false;
     }
 
-    return out_it;
-  }
+    // Evaluate row i checking every step, which is needed only for the
+    // last row or two before the tangent numbers overflow T. Returns false
+    // on overflow, leaving the row in an unspecified state.
+    bool next_row_checked(const std::size_t i)
+    {
+      if(boost::math::tools::max_value<T>() / (i - 1) < m_row[1U])
+      {
+        return false;
+      }
 
-  template <class T>
-  struct max_bernoulli_index
-  {
-    BOOST_STATIC_CONSTANT(unsigned, value = 17);
-  };
+      m_busy = true;
 
-  template <>
-  struct max_bernoulli_index<float>
-  {
-    BOOST_STATIC_CONSTANT(unsigned, value = 31);
-  };
+      m_row[1U] *= (i - 1);
+      m_row.push_back(T(0U));
 
-  template <>
-  struct max_bernoulli_index<double>
-  {
-    BOOST_STATIC_CONSTANT(unsigned, value = 129);
+      for(std::size_t j = 2U; j <= i; j++)
+      {
+        if(   ((j != i) && (boost::math::tools::max_value<T>() / (i - j) < m_row[j]))
+           || (boost::math::tools::max_value<T>() / (i - j + 2) < m_row[j - 1])
+           || (boost::math::tools::max_value<T>() - m_row[j] * (i - j) < m_row[j - 1] * (i - j + 2))
+           || ((boost::math::isinf)(m_row[j - 1])))
+        {
+          m_busy = false;
+          return false;
+        }
+
+        m_row[j] = (m_row[j] * (i - j)) + (m_row[j - 1] * (i - j + 2));
+      }
+
+      m_busy = false;
+
+      return true;
+    }
+
+    template <class Policy>
+    T overflow(const Policy& pol)
+    {
+      // The tangent numbers are increasing, so once one has
+      // overflowed, all that follow do too: the row is no longer needed.
+      const std::size_t i = m_size;
+
+      m_overflow = true;
+      m_row.clear();
+      ++m_size;
+
+      return policies::raise_overflow_error<T>("boost::math::bernoulli<%1%>", "Overflow error while calculating tangent number %1%", T(i), pol);
+    }
+
+    std::vector<T> m_row;
+    std::size_t    m_size;
+    bool           m_overflow;
+    bool           m_busy;
   };
 
-  template <>
-  struct max_bernoulli_index<long double>
+  // Storage whose first size() elements are immutable once they have been
+  // published, and live in memory that is never moved or freed while the
+  // storage is alive. Readers therefore only perform an acquire-load of the
+  // published size followed by a load of the data pointer, and never take
+  // a lock. Writers must be serialized by the owner.
+  //
+  // When the capacity is exhausted, a larger buffer is allocated, the already
+  // published elements are copied into it and the new buffer is published
+  // before the new size. Superseded buffers are retained (not freed) so that
+  // any reader still holding a pointer into them remains valid.
+  template <class V>
+  class bernoulli_published_storage : private boost::noncopyable
   {
-    BOOST_STATIC_CONSTANT(unsigned, value = 129);
-  };
+  public:
+    bernoulli_published_storage() : m_data(0), m_size(0U), m_storage(0), m_capacity(0U) { }
 
-  template <class T>
-  inline T unchecked_bernoulli_imp(size_t n, const mpl::int_<3>& )
-  {
-    static const boost::array<boost::int64_t, 18U> numerators =
-    {{
-      boost::int64_t(            +1LL),
-      boost::int64_t(            +1LL),
-      boost::int64_t(            -1LL),
-      boost::int64_t(            +1LL),
-      boost::int64_t(            -1LL),
-      boost::int64_t(            +5LL),
-      boost::int64_t(          -691LL),
-      boost::int64_t(            +7LL),
-      boost::int64_t(         -3617LL),
-      boost::int64_t(        +43867LL),
-      boost::int64_t(       -174611LL),
-      boost::int64_t(       +854513LL),
-      boost::int64_t(    -236364091LL),
-      boost::int64_t(      +8553103LL),
-      boost::int64_t(  -23749461029LL),
-      boost::int64_t(+8615841276005LL),
-      boost::int64_t(-7709321041217LL),
-      boost::int64_t(+2577687858367LL)
-    }};
-
-    static const boost::array<boost::int64_t, 18U> denominators =
-    {{
-      boost::int64_t(      1LL),
-      boost::int64_t(      6LL),
-      boost::int64_t(     30LL),
-      boost::int64_t(     42LL),
-      boost::int64_t(     30LL),
-      boost::int64_t(     66LL),
-      boost::int64_t(   2730LL),
-      boost::int64_t(      6LL),
-      boost::int64_t(    510LL),
-      boost::int64_t(    798LL),
-      boost::int64_t(    330LL),
-      boost::int64_t(    138LL),
-      boost::int64_t(   2730LL),
-      boost::int64_t(      6LL),
-      boost::int64_t(    870LL),
-      boost::int64_t(  14322LL),
-      boost::int64_t(    510LL),
-      boost::int64_t(      6LL)
-    }};
-    return T(numerators[n]) / denominators[n];
-  }
-
-  template <class T>
-  inline T unchecked_bernoulli_imp(size_t n, const mpl::int_<1>& )
-  {
-    static const boost::array<float, 32U> bernoulli_data =
-    {{
-      static_cast<T>(+1.00000000000000000000000000000000000000000F),
-      static_cast<T>(+0.166666666666666666666666666666666666666667F),
-      static_cast<T>(-0.0333333333333333333333333333333333333333333F),
-      static_cast<T>(+0.0238095238095238095238095238095238095238095F),
-      static_cast<T>(-0.0333333333333333333333333333333333333333333F),
-      static_cast<T>(+0.0757575757575757575757575757575757575757576F),
-      static_cast<T>(-0.253113553113553113553113553113553113553114F),
-      static_cast<T>(+1.16666666666666666666666666666666666666667F),
-      static_cast<T>(-7.09215686274509803921568627450980392156863F),
-      static_cast<T>(+54.9711779448621553884711779448621553884712F),
-      static_cast<T>(-529.124242424242424242424242424242424242424F),
-      static_cast<T>(+6192.12318840579710144927536231884057971014F),
-      static_cast<T>(-86580.2531135531135531135531135531135531136F),
-      static_cast<T>(+1.42551716666666666666666666666666666666667E6F),
-      static_cast<T>(-2.72982310678160919540229885057471264367816E7F),
-      static_cast<T>(+6.01580873900642368384303868174835916771401E8F),
-      static_cast<T>(-1.51163157670921568627450980392156862745098E10F),
-      static_cast<T>(+4.29614643061166666666666666666666666666667E11F),
-      static_cast<T>(-1.37116552050883327721590879485616327721591E13F),
-      static_cast<T>(+4.88332318973593166666666666666666666666667E14F),
-      static_cast<T>(-1.92965793419400681486326681448632668144863E16F),
-      static_cast<T>(+8.41693047573682615000553709856035437430786E17F),
-      static_cast<T>(-4.03380718540594554130768115942028985507246E19F),
-      static_cast<T>(+2.11507486380819916056014539007092198581560E21F),
-      static_cast<T>(-1.20866265222965259346027311937082525317819E23F),
-      static_cast<T>(+7.50086674607696436685572007575757575757576E24F),
-      static_cast<T>(-5.03877810148106891413789303052201257861635E26F),
-      static_cast<T>(+3.65287764848181233351104308429711779448622E28F),
-      static_cast<T>(-2.84987693024508822262691464329106781609195E30F),
-      static_cast<T>(+2.38654274996836276446459819192192149717514E32F),
-      static_cast<T>(-2.13999492572253336658107447651910973926742E34F),
-      static_cast<T>(+2.05009757234780975699217330956723102516667E36F)
-    }};
-
-    return bernoulli_data[n];
-  }
-
-
-  template <class T>
-  inline T unchecked_bernoulli_imp(size_t n, const mpl::int_<2>& )
-  {
-    static const boost::array<long double, 130U> bernoulli_data =
-    {{
-      static_cast<T>(+1.00000000000000000000000000000000000000000L),
-      static_cast<T>(+0.166666666666666666666666666666666666666667L),
-      static_cast<T>(-0.0333333333333333333333333333333333333333333L),
-      static_cast<T>(+0.0238095238095238095238095238095238095238095L),
-      static_cast<T>(-0.0333333333333333333333333333333333333333333L),
-      static_cast<T>(+0.0757575757575757575757575757575757575757576L),
-      static_cast<T>(-0.253113553113553113553113553113553113553114L),
-      static_cast<T>(+1.16666666666666666666666666666666666666667L),
-      static_cast<T>(-7.09215686274509803921568627450980392156863L),
-      static_cast<T>(+54.9711779448621553884711779448621553884712L),
-      static_cast<T>(-529.124242424242424242424242424242424242424L),
-      static_cast<T>(+6192.12318840579710144927536231884057971014L),
-      static_cast<T>(-86580.2531135531135531135531135531135531136L),
-      static_cast<T>(+1.42551716666666666666666666666666666666667E6L),
-      static_cast<T>(-2.72982310678160919540229885057471264367816E7L),
-      static_cast<T>(+6.01580873900642368384303868174835916771401E8L),
-      static_cast<T>(-1.51163157670921568627450980392156862745098E10L),
-      static_cast<T>(+4.29614643061166666666666666666666666666667E11L),
-      static_cast<T>(-1.37116552050883327721590879485616327721591E13L),
-      static_cast<T>(+4.88332318973593166666666666666666666666667E14L),
-      static_cast<T>(-1.92965793419400681486326681448632668144863E16L),
-      static_cast<T>(+8.41693047573682615000553709856035437430786E17L),
-      static_cast<T>(-4.03380718540594554130768115942028985507246E19L),
-      static_cast<T>(+2.11507486380819916056014539007092198581560E21L),
-      static_cast<T>(-1.20866265222965259346027311937082525317819E23L),
-      static_cast<T>(+7.50086674607696436685572007575757575757576E24L),
-      static_cast<T>(-5.03877810148106891413789303052201257861635E26L),
-      static_cast<T>(+3.65287764848181233351104308429711779448622E28L),
-      static_cast<T>(-2.84987693024508822262691464329106781609195E30L),
-      static_cast<T>(+2.38654274996836276446459819192192149717514E32L),
-      static_cast<T>(-2.13999492572253336658107447651910973926742E34L),
-      static_cast<T>(+2.05009757234780975699217330956723102516667E36L),
-      static_cast<T>(-2.09380059113463784090951852900279701847092E38L),
-      static_cast<T>(+2.27526964884635155596492603527692645814700E40L),
-      static_cast<T>(-2.62577102862395760473030497361582020814490E42L),
-      static_cast<T>(+3.21250821027180325182047923042649852435219E44L),
-      static_cast<T>(-4.15982781667947109139170744952623589366896E46L),
-      static_cast<T>(+5.69206954820352800238834562191210586444805E48L),
-      static_cast<T>(-8.21836294197845756922906534686173330145509E50L),
-      static_cast<T>(+1.25029043271669930167323398297028955241772E53L),
-      static_cast<T>(-2.00155832332483702749253291988132987687242E55L),
-      static_cast<T>(+3.36749829153643742333966769033387530162196E57L),
-      static_cast<T>(-5.94709705031354477186604968440515408405791E59L),
-      static_cast<T>(+1.10119103236279775595641307904376916046305E62L),
-      static_cast<T>(-2.13552595452535011886583850190410656789733E64L),
-      static_cast<T>(+4.33288969866411924196166130593792062184514E66L),
-      static_cast<T>(-9.18855282416693282262005552155018971389604E68L),
-      static_cast<T>(+2.03468967763290744934550279902200200659751E71L),
-      static_cast<T>(-4.70038339580357310785752555350060606545967E73L),
-      static_cast<T>(+1.13180434454842492706751862577339342678904E76L),
-      static_cast<T>(-2.83822495706937069592641563364817647382847E78L),
-      static_cast<T>(+7.40642489796788506297508271409209841768797E80L),
-      static_cast<T>(-2.00964548027566044834656196727153631868673E83L),
-      static_cast<T>(+5.66571700508059414457193460305193569614195E85L),
-      static_cast<T>(-1.65845111541362169158237133743199123014950E88L),
-      static_cast<T>(+5.03688599504923774192894219151801548124424E90L),
-      static_cast<T>(-1.58614682376581863693634015729664387827410E93L),
-      static_cast<T>(+5.17567436175456269840732406825071225612408E95L),
-      static_cast<T>(-1.74889218402171173396900258776181591451415E98L),
-      static_cast<T>(+6.11605199949521852558245252642641677807677E100L),
-      static_cast<T>(-2.21227769127078349422883234567129324455732E103L),
-      static_cast<T>(+8.27227767987709698542210624599845957312047E105L),
-      static_cast<T>(-3.19589251114157095835916343691808148735263E108L),
-      static_cast<T>(+1.27500822233877929823100243029266798669572E111L),
-      static_cast<T>(-5.25009230867741338994028246245651754469199E113L),
-      static_cast<T>(+2.23018178942416252098692981988387281437383E116L),
-      static_cast<T>(-9.76845219309552044386335133989802393011669E118L),
-      static_cast<T>(+4.40983619784529542722726228748131691918758E121L),
-      static_cast<T>(-2.05085708864640888397293377275830154864566E124L),
-      static_cast<T>(+9.82144332797912771075729696020975210414919E126L),
-      static_cast<T>(-4.84126007982088805087891967099634127611305E129L),
-      static_cast<T>(+2.45530888014809826097834674040886903996737E132L),
-      static_cast<T>(-1.28069268040847475487825132786017857218118E135L),
-      static_cast<T>(+6.86761671046685811921018885984644004360924E137L),
-      static_cast<T>(-3.78464685819691046949789954163795568144895E140L),
-      static_cast<T>(+2.14261012506652915508713231351482720966602E143L),
-      static_cast<T>(-1.24567271371836950070196429616376072194583E146L),
-      static_cast<T>(+7.43457875510001525436796683940520613117807E148L),
-      static_cast<T>(-4.55357953046417048940633332233212748767721E151L),
-      static_cast<T>(+2.86121128168588683453638472510172325229190E154L),
-      static_cast<T>(-1.84377235520338697276882026536287854875414E157L),
-      static_cast<T>(+1.21811545362210466995013165065995213558174E160L),
-      static_cast<T>(-8.24821871853141215484818457296893447301419E162L),
-      static_cast<T>(+5.72258779378329433296516498142978615918685E165L),
-      static_cast<T>(-4.06685305250591047267679693831158655602196E168L),
-      static_cast<T>(+2.95960920646420500628752695815851870426379E171L),
-      static_cast<T>(-2.20495225651894575090311752273445984836379E174L),
-      static_cast<T>(+1.68125970728895998058311525151360665754464E177L),
-      static_cast<T>(-1.31167362135569576486452806355817153004431E180L),
-      static_cast<T>(+1.04678940094780380821832853929823089643829E183L),
-      static_cast<T>(-8.54328935788337077185982546299082774593270E185L),
-      static_cast<T>(+7.12878213224865423522884066771438224721245E188L),
-      static_cast<T>(-6.08029314555358993000847118686477458461988E191L),
-      static_cast<T>(+5.29967764248499239300942910043247266228490E194L),
-      static_cast<T>(-4.71942591687458626443646229013379911103761E197L),
-      static_cast<T>(+4.29284137914029810894168296541074669045521E200L),
-      static_cast<T>(-3.98767449682322074434477655542938795106651E203L),
-      static_cast<T>(+3.78197804193588827138944181161393327898220E206L),
-      static_cast<T>(-3.66142336836811912436858082151197348755196E209L),
-      static_cast<T>(+3.61760902723728623488554609298914089477541E212L),
-      static_cast<T>(-3.64707726451913543621383088655499449048682E215L),
-      static_cast<T>(+3.75087554364544090983452410104814189306842E218L),
-      static_cast<T>(-3.93458672964390282694891288533713429355657E221L),
-      static_cast<T>(+4.20882111481900820046571171111494898242731E224L),
-      static_cast<T>(-4.59022962206179186559802940573325591059371E227L),
-      static_cast<T>(+5.10317257726295759279198185106496768539760E230L),
-      static_cast<T>(-5.78227623036569554015377271242917142512200E233L),
-      static_cast<T>(+6.67624821678358810322637794412809363451080E236L),
-      static_cast<T>(-7.85353076444504163225916259639312444428230E239L),
-      static_cast<T>(+9.41068940670587255245443288258762485293948E242L),
-      static_cast<T>(-1.14849338734651839938498599206805592548354E246L),
-      static_cast<T>(+1.42729587428487856771416320087122499897180E249L),
-      static_cast<T>(-1.80595595869093090142285728117654560926719E252L),
-      static_cast<T>(+2.32615353076608052161297985184708876161736E255L),
-      static_cast<T>(-3.04957517154995947681942819261542593785327E258L),
-      static_cast<T>(+4.06858060764339734424012124124937318633684E261L),
-      static_cast<T>(-5.52310313219743616252320044093186392324280E264L),
-      static_cast<T>(+7.62772793964343924869949690204961215533859E267L),
-      static_cast<T>(-1.07155711196978863132793524001065396932667E271L),
-      static_cast<T>(+1.53102008959691884453440916153355334355847E274L),
-      static_cast<T>(-2.22448916821798346676602348865048510824835E277L),
-      static_cast<T>(+3.28626791906901391668189736436895275365183E280L),
-      static_cast<T>(-4.93559289559603449020711938191575963496999E283L),
-      static_cast<T>(+7.53495712008325067212266049779283956727824E286L),
-      static_cast<T>(-1.16914851545841777278088924731655041783900E290L),
-      static_cast<T>(+1.84352614678389394126646201597702232396492E293L),
-      static_cast<T>(-2.95368261729680829728014917350525183485207E296L),
-      static_cast<T>(+4.80793212775015697668878704043264072227967E299L),
-      static_cast<T>(-7.95021250458852528538243631671158693036798E302L),
-      static_cast<T>(+1.33527841873546338750122832017820518292039E306L)
-    }};
-
-    return bernoulli_data[n];
-  }
+    ~bernoulli_published_storage()
+    {
+      for(std::size_t i = 0U; i < m_buffers.size(); ++i)
+      {
+        delete m_buffers[i];
+      }
+    }
 
-  template<class T>
-  inline T unchecked_bernoulli_b2n(size_t n)
-  {
-    typedef typename mpl::if_c<
-         (std::numeric_limits<T>::max_exponent >= 128)
-      && (std::numeric_limits<T>::max_exponent < 1024)
-      && (std::numeric_limits<T>::digits10 <= std::numeric_limits<float>::digits10)
-      && boost::is_convertible<T, float>::value,
-
-      mpl::int_<1>,
-
-      typename mpl::if_c<
-           (std::numeric_limits<T>::max_exponent >= 1024)
-        && (std::numeric_limits<T>::digits10 <= std::numeric_limits<long double>::digits10)
-        && boost::is_convertible<T, long double>::value,
-        mpl::int_<2>,
-        mpl::int_<3>
-      >::type
-    >::type tag_type;
+    // Reader side: load size() first, the pointer returned by
+    // a subsequent call to data() holds at least that many elements.
+    std::size_t size() const { return m_size.acquire_load(); }
+    const V*    data() const { return m_data.acquire_load(); }
+
+    // Writer side: return storage for at least count elements whose
+    // first size() elements are the published ones. The elements beyond
+    // size() may be written freely: no reader can be looking at them yet.
+    V* prepare(const std::size_t count)
+    {
+      if(count <= m_capacity)
+      {
+        return m_storage;
+      }
+
+      const std::size_t new_capacity = (std::max)(count, std::size_t(m_capacity * 2U));
+
+      // The buffer is owned from the outset, so that it is
+      // released even if filling it subsequently raises an error.
+      m_buffers.reserve(m_buffers.size() + 1U);
+      m_buffers.push_back(new std::vector<V>(new_capacity));
+
+      V* new_storage = &(*m_buffers.back())[0U];
+
+      std::copy(m_storage, m_storage + m_size.acquire_load(), new_storage);
+
+      return new_storage;
+    }
+
+    // Writer side: publish the first count elements of storage,
+    // which must have been obtained from prepare().
+    void publish(V* storage, const std::size_t count)
+    {
+      if(storage != m_storage)
+      {
+        m_storage  = storage;
+        m_capacity = m_buffers.back()->size();
+        m_data.release_store(storage);
+      }
+
+      m_size.release_store(count);
+    }
+
+  private:
+    bernoulli_atomic<const V*>    m_data;
+    bernoulli_atomic<std::size_t> m_size;
+    V*                            m_storage;
+    std::size_t                   m_capacity;
+    std::vector<std::vector<V>*>  m_buffers;
+  };
+
+  // Whether the Bernoulli numbers of type T are obtained from the process-wide
+  // table of exact tangent numbers, rather than by running the tangent number
+  // recurrence in T itself. The exact table is shared by every type and
+  // precision, so that a program which uses several precisions computes the
+  // tangent numbers only once; each type then needs just one conversion and
+  // one scaling per entry. The exact integers grow to about n log2(n) bits,
+  // which is far wider than a low precision type, so this is opt-in.
+  template <class T>
+  struct bernoulli_exact_tangent_numbers
+  {
+  #ifdef BOOST_MATH_BERNOULLI_EXACT_TANGENT_NUMBERS
+    BOOST_STATIC_CONSTANT(bool, value = boost::multiprecision::is_number<T>::value);
+  #else
+    BOOST_STATIC_CONSTANT(bool, value = false);
+  #endif
+  };
+
+  #ifdef BOOST_MATH_BERNOULLI_EXACT_TANGENT_NUMBERS
+
+  // The process-wide table of exact tangent numbers T_n, grown on demand
+  // with the row by row form of the recurrence used by
+  // tangent_numbers_generator. Integers can't overflow, so no checks are needed.
+  class tangent_numbers_master_table : private boost::noncopyable
+  {
+  public:
+    typedef boost::multiprecision::cpp_int value_type;
+
+    tangent_numbers_master_table() : m_busy(false) { }
+
+    // Ensure that T_n is available for all n in [0, count) and return
+    // a pointer to the first element, valid for the lifetime of the table.
+    const value_type* ensure(const std::size_t count)
+    {
+      if(m_numbers.size() >= count)
+      {
+        return m_numbers.data();
+      }
+
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      const std::size_t previous_size = m_numbers.size();
+
+      if(previous_size < count)
+      {
+        if(m_busy)
+        {
+          // An exception escaped part way through a row: rebuild it.
+          m_row.clear();
+
+          for(std::size_t i = 0U; i < previous_size; ++i)
+          {
+            static_cast<void>(next());
+          }
+        }
+
+        value_type* storage = m_numbers.prepare(count);
+
+        for(std::size_t i = previous_size; i < count; ++i)
+        {
+          storage[i] = next();
+        }
+
+        m_numbers.publish(storage, count);
+      }
+
+      return m_numbers.data();
+    }
+
+  private:
+    value_type next()
+    {
+      const std::size_t i = m_row.size();
+
+      if(i < 2U)
+      {
+        m_row.push_back(value_type(i));
+        return value_type(i);
+      }
+
+      m_busy = true;
+
+      m_row[1U] *= (i - 1);
+      m_row.push_back(value_type(0U));
+
+      for(std::size_t j = 2U; j <= i; j++)
+      {
+        m_row[j] *= (i - j);
+        m_row[j] += m_row[j - 1] * (i - j + 2);
+      }
+
+      m_busy = false;
+
+      return m_row[i];
+    }
+
+    bernoulli_published_storage<value_type> m_numbers;
+    std::vector<value_type>                 m_row;
+    bool                                    m_busy;
+    boost::detail::lightweight_mutex        m_mutex;
+  };
+
+  inline tangent_numbers_master_table& get_tangent_numbers_master_table()
+  {
+    static tangent_numbers_master_table table;
+    return table;
+  }
+
+  template <class T, class Policy>
+  void exact_tangent_numbers_series(T* bn, const size_t start_index, const size_t number_of_bernoullis_bn, Policy&)
+  {
+    BOOST_MATH_STD_USING
+
+    typedef tangent_numbers_master_table::value_type value_type;
+
+    const value_type* tangent_numbers = get_tangent_numbers_master_table().ensure(start_index + number_of_bernoullis_bn);
+
+    // Keep some guard bits beyond the precision of T in the conversion.
+    const std::size_t digits = static_cast<std::size_t>(boost::math::tools::digits<T>()) + 32U;
+
+    for(size_t i = 0; i < number_of_bernoullis_bn; i++)
+    {
+      const std::size_t n = i + start_index;
+
+      if(n == 0U)
+      {
+        bn[i] = T(1U);
+        continue;
+      }
+
+      // B2n = (-1)^(n+1) 2n T_n / (2^(2n) (2^(2n) - 1))
+      //     = (-1)^(n+1) 2n T_n 2^(-4n) / (1 - 2^(-2n)),
+      // so with T_n = t 2^shift, all the scaling is exact apart from
+      // a single multiplication and division.
+      const std::size_t bits  = static_cast<std::size_t>(msb(tangent_numbers[n])) + 1U;
+      const std::size_t shift = ((bits > digits) ? (bits - digits) : 0U);
+
+      T b = static_cast<T>(value_type(tangent_numbers[n] >> shift));
+
+      b *= static_cast<boost::uint32_t>(2U * n);
+      b /= (1 - ldexp(T(1), -2 * static_cast<int>(n)));
+      b  = ldexp(b, static_cast<int>(shift) - 4 * static_cast<int>(n));
+
+      bn[i] = (((n % 2U) != 0U) ? b : T(-b));
+    }
+  }
+
+  #endif // BOOST_MATH_BERNOULLI_EXACT_TANGENT_NUMBERS
+
+  // Write B2n for n in [start_index, start_index + number_of_bernoullis_bn)
+  // to bn: the tangent numbers are generated into bn itself and then scaled
+  // in place, so that nothing is allocated besides the generator's row.
+  template <class T, class Policy>
+  void tangent_numbers_series(T* bn, tangent_numbers_generator<T>& generator, const size_t start_index, const size_t number_of_bernoullis_bn, Policy &pol, const unsigned thread_count)
+  {
+    generator.generate(start_index, number_of_bernoullis_bn, bn, pol, thread_count);
+
+    T power_two(1);
+
+    power_two = ldexp(T(1), 2 * static_cast<boost::int32_t>(start_index));
+
+    for(size_t i = 0; i < number_of_bernoullis_bn; i++)
+    {
+      T b((T(i + start_index) * 2));
+
+      if(   ((boost::math::isinf)(bn[i]))
+         || (bn[i] >= boost::math::tools::max_value<T>()))
+      {
+        // The tangent number overflowed (and the policy let us continue),
+        // so the Bernoulli number does too: don't let the scaling below
+        // turn the overflow value into a spurious finite result.
+        b = (std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                  : boost::math::tools::max_value<T>());
+      }
+      else
+      {
+        b  = b / (power_two * (power_two - 1));
+        b *= bn[i];
+      }
+
+      power_two *= 4;
+
+      const bool b_neg = (static_cast<boost::int32_t>((i + start_index) % static_cast<boost::int32_t>(2)) == static_cast<boost::int32_t>(0));
+
+      bn[i] = ((!b_neg) ? b : -b);
+    }
+  }
+
+  template <class T, class Policy>
+  inline void bernoulli_series_from_tangent_numbers(T* bn, tangent_numbers_generator<T>& generator, const size_t start_index, const size_t number_of_bernoullis_bn, Policy& pol, const unsigned thread_count, const mpl::false_&)
+  {
+    tangent_numbers_series(bn, generator, start_index, number_of_bernoullis_bn, pol, thread_count);
+  }
+
+  #ifdef BOOST_MATH_BERNOULLI_EXACT_TANGENT_NUMBERS
+  template <class T, class Policy>
+  inline void bernoulli_series_from_tangent_numbers(T* bn, tangent_numbers_generator<T>&, const size_t start_index, const size_t number_of_bernoullis_bn, Policy& pol, const unsigned, const mpl::true_&)
+  {
+    // The exact table is always grown in the calling thread.
+    exact_tangent_numbers_series(bn, start_index, number_of_bernoullis_bn, pol);
+  }
+  #endif
+
+  // Write B2n for n in [start_index, start_index + number_of_bernoullis_bn)
+  // to out_it, which is the cache storage: the series is generated there
+  // directly, with no intermediate copies.
+  template <class T, class Policy>
+  inline T* cache_imp(size_t start_index,
+                      size_t number_of_bernoullis_bn,
+                      T* out_it,
+                      tangent_numbers_generator<T>& generator,
+                      const Policy& pol,
+                      const unsigned thread_count = 1U)
+  {
+
+    if((start_index + number_of_bernoullis_bn - 1) <= max_bernoulli_index<T>::value)
+    {
+      T* last= out_it + number_of_bernoullis_bn;
+
+      while(out_it!=last)
+      {
+        *out_it = unchecked_bernoulli_b2n<T>(start_index);
+        ++out_it;
+        ++start_index;
+      }
+
+      //return one past the last element
+      return out_it;
+    }
+    else if(   ( start_index <= static_cast<boost::int32_t>(max_bernoulli_index<T>::value))
+            && ((start_index + number_of_bernoullis_bn) > static_cast<boost::int32_t>(max_bernoulli_index<T>::value))
+           )
+    {
+      out_it=cache_imp<T,Policy>(start_index,max_bernoulli_index<T>::value - start_index +1, out_it,generator,pol,thread_count);
+
+      out_it=cache_imp<T,Policy>(max_bernoulli_index<T>::value+1,
+                                                number_of_bernoullis_bn - max_bernoulli_index<T>::value + start_index -1,
+                                                out_it,
+                                                generator,
+                                                pol,
+                                                thread_count);
+      return out_it;
+    }
+
+    bernoulli_series_from_tangent_numbers(out_it, generator, start_index, number_of_bernoullis_bn, pol, thread_count, mpl::bool_<bernoulli_exact_tangent_numbers<T>::value>());
+
+    return out_it + number_of_bernoullis_bn;
+  }
+
+  // The cache file holds one entry per line: the index n, the number of binary
+  // digits in T, B2n, a checksum, and the name of T. Lines for other types or
+  // precisions are ignored, so one file can serve several types. Entries are
+  // only ever appended, each batch of lines in a single write, and several
+  // processes may append the same entries, in any order. The reader skips
+  // lines that fail their checksum, as the torn or interleaved writes of a
+  // crashed or concurrent process would, and those whose B2n has the wrong
+  // sign, takes the first valid occurrence of each index, and loads the
+  // entries from n = 0 up to the first index it has no value for.
+  // 32-bit FNV-1a of the characters in [first, last), continuing from h.
+  inline boost::uint32_t bernoulli_cache_file_checksum(const char* first, const char* last, boost::uint32_t h = 2166136261U)
+  {
+    for( ; first != last; ++first)
+    {
+      h ^= static_cast<boost::uint32_t>(static_cast<unsigned char>(*first));
+      h *= 16777619U;
+    }
+
+    return h;
+  }
+
+  inline boost::uint32_t bernoulli_cache_file_checksum(const std::string& text)
+  {
+    return bernoulli_cache_file_checksum(text.data(), text.data() + text.size());
+  }
+
+  // Reads the digits in base at p, up to last, into value, returning the
+  // character after them, or 0 if there are none.
+  template <class Integer>
+  inline const char* bernoulli_cache_file_parse(const char* p, const char* last, Integer& value, const unsigned base = 10U)
+  {
+    const char* first = p;
+
+    value = 0;
+
+    for( ; p != last; ++p)
+    {
+      const unsigned digit = (((*p >= '0') && (*p <= '9')) ? static_cast<unsigned>(*p - '0')
+                            : ((*p >= 'a') && (*p <= 'f')) ? static_cast<unsigned>(*p - 'a') + 10U
+                            : base);
+
+      if(digit >= base)
+      {
+        break;
+      }
+
+      value = static_cast<Integer>((value * base) + digit);
+    }
+
+    return ((p != first) ? p : 0);
+  }
+
+  template <class T>
+  void bernoulli_cache_file_read(const std::string& filename, std::vector<T>& values)
+  {
+    std::string text;
+
+    {
+      std::ifstream is(filename.c_str(), std::ios_base::in | std::ios_base::binary);
+
+      text.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    }
+
+    const std::string name(policies::detail::name_of<T>());
+    const int         digits = boost::math::tools::digits<T>();
+
+    // Entry n can only be loaded if the entries before it are there too,
+    // each on a line of its own: indices past the number of lines are
+    // skipped, so that the entries can be kept by index.
+    const std::size_t line_count = static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n')) + 1U;
+
+    std::vector<T>    entries;
+    std::vector<bool> found;
+
+    std::istringstream value_stream;
+
+    value_stream.imbue(std::locale::classic());
+
+    const char* const end = text.data() + text.size();
+
+    for(const char* line = text.data(); line != end; )
+    {
+      const char* line_end = std::find(line, end, '\n');
+
+      const char* const next = ((line_end != end) ? (line_end + 1) : end);
+
+      // index digits value checksum name
+      std::size_t     index;
+      int             line_digits;
+      boost::uint32_t checksum;
+
+      const char* p           = bernoulli_cache_file_parse(line, line_end, index);
+      const char* value_first = 0;
+      const char* value_last  = 0;
+
+      if((p != 0) && (p != line_end) && (*p == ' ') && (index < line_count) && ((index >= found.size()) || !found[index]))
+      {
+        p = bernoulli_cache_file_parse(p + 1, line_end, line_digits);
+      }
+      else
+      {
+        p = 0;
+      }
+
+      if((p != 0) && (p != line_end) && (*p == ' ') && (line_digits == digits))
+      {
+        value_first = p + 1;
+        value_last  = std::find(value_first, line_end, ' ');
+
+        p = ((value_last != line_end) ? bernoulli_cache_file_parse(value_last + 1, line_end, checksum, 16U) : 0);
+      }
+      else
+      {
+        p = 0;
+      }
+
+      if(   (p == 0)
+         || (p == line_end)
+         || (*p != ' ')
+         || (static_cast<std::size_t>(line_end - (p + 1)) != name.size())
+         || (!std::equal(name.begin(), name.end(), p + 1))
+         || (bernoulli_cache_file_checksum(p, line_end, bernoulli_cache_file_checksum(line, value_last)) != checksum))
+      {
+        line = next;
+        continue;
+      }
+
+      value_stream.clear();
+      value_stream.str(std::string(value_first, value_last));
+
+      T value;
+
+      // B2n has the sign of (-1)^(n+1), and B0 = 1.
+      if(   (value_stream >> value)
+         && ((index == 0U) ? (value == 1) : ((value > 0) == ((index % 2U) != 0U))))
+      {
+        if(index >= entries.size())
+        {
+          entries.resize(index + 1U);
+          found.resize(index + 1U, false);
+        }
+
+        entries[index] = value;
+        found[index]   = true;
+      }
+
+      line = next;
+    }
+
+    for(std::size_t i = values.size(); (i < found.size()) && found[i]; ++i)
+    {
+      values.push_back(entries[i]);
+    }
+  }
+
+  template <class T>
+  void bernoulli_cache_file_append(const std::string& filename, const T* values, const std::size_t first, const std::size_t last)
+  {
+    if(first >= last)
+    {
+      return;
+    }
+
+    const char* name   = policies::detail::name_of<T>();
+    const int   digits = boost::math::tools::digits<T>();
+
+    // In the classic locale, as the entries are read back.
+    std::ostringstream lines;
+
+    lines.imbue(std::locale::classic());
+
+    for(std::size_t i = first; i < last; ++i)
+    {
+      std::ostringstream value_text;
+
+      value_text.imbue(std::locale::classic());
+
+      // Enough decimal digits for the values to be read back exactly.
+      value_text << std::scientific << std::setprecision(2 + static_cast<int>((digits * 30103L) / 100000L)) << values[i];
+
+      std::ostringstream body;
+
+      body.imbue(std::locale::classic());
+
+      body << i << ' ' << digits << ' ' << value_text.str();
+
+      lines << body.str() << ' ' << std::hex << bernoulli_cache_file_checksum(body.str() + ' ' + name) << std::dec << ' ' << name << '\n';
+    }
+
+    std::string text(lines.str());
+
+    {
+      // A writer that crashed may have left a line without its end: start
+      // a new line, so that the first of these entries isn't lost with it.
+      std::ifstream is(filename.c_str(), std::ios_base::in | std::ios_base::binary);
+
+      if(is.seekg(-1, std::ios_base::end) && (is.get() != '\n'))
+      {
+        text.insert(text.begin(), '\n');
+      }
+    }
+
+    // Unbuffered, so that the whole batch goes to the file in one write
+    // rather than in pieces that another process could come between.
+    std::ofstream os;
+
+    os.rdbuf()->pubsetbuf(0, 0);
+
+    os.open(filename.c_str(), std::ios_base::out | std::ios_base::app | std::ios_base::binary);
+
+    os.write(text.data(), static_cast<std::streamsize>(text.size()));
+  }
+
+  // An estimate of the memory held by each cached value of type T: the
+  // object itself and, for a multiprecision type, its digits.
+  template <class T>
+  inline std::size_t bernoulli_entry_bytes()
+  {
+    return sizeof(T) + static_cast<std::size_t>(boost::math::tools::digits<T>() / CHAR_BIT);
+  }
+
+  // The largest n for which the cache can hold a finite B2n in T. The
+  // compiled-in tables of the builtin types run right up to the overflow
+  // threshold. Past its table, any other type, including one that shares a
+  // table but not the exponent range it was made for, is generated from the
+  // tangent numbers T_n = (-1)^(n+1) 2^(2n) (2^(2n) - 1) B2n / (2n), which
+  // overflow well before B2n does; n is then estimated from
+  // |B2n| ~ 2 (2n)! / (2 pi)^(2n) with Stirling's formula for (2n)!. The
+  // estimate may be one too large: the cache records the first index that
+  // actually overflows.
+  template <class T>
+  std::size_t bernoulli_max_finite_index_imp(const mpl::true_&)
+  {
+    return static_cast<std::size_t>(max_bernoulli_index<T>::value);
+  }
+
+  inline double bernoulli_log_tangent_number_estimate(const std::size_t n)
+  {
+    BOOST_MATH_STD_USING
+
+    const double two_pi = 6.283185307179586476925286766559;
+    const double m      = 2.0 * static_cast<double>(n);
+
+    const double log_b2n = log(2.0) + (m * log(m)) - m + (0.5 * log(two_pi * m)) + (1.0 / (12.0 * m)) - (m * log(two_pi));
+
+    return log_b2n + ((2.0 * m) * log(2.0)) - log(m);
+  }
+
+  template <class T>
+  std::size_t bernoulli_max_finite_index_imp(const mpl::false_&)
+  {
+    // Compared in T: a multiprecision type need not convert to double.
+    const T log_max_value = boost::math::tools::log_max_value<T>();
+
+    // Find the first index that overflows: double the upper bound until
+    // it does, then bisect.
+    std::size_t lower = 1U;
+    std::size_t upper = 2U;
+
+    while((T(bernoulli_log_tangent_number_estimate(upper)) < log_max_value) && (upper < ((std::numeric_limits<std::size_t>::max)() / 4U)))
+    {
+      lower  = upper;
+      upper *= 2U;
+    }
+
+    while(upper > (lower + 1U))
+    {
+      const std::size_t mid = lower + ((upper - lower) / 2U);
+
+      if(T(bernoulli_log_tangent_number_estimate(mid)) < log_max_value)
+      {
+        lower = mid;
+      }
+      else
+      {
+        upper = mid;
+      }
+    }
+
+    return (std::max)(lower, static_cast<std::size_t>(max_bernoulli_index<T>::value));
+  }
+
+  // Whether T has exactly the exponent range that its compiled-in table was
+  // made for: float, double, and 80-bit or quad precision (16384, or 16383
+  // as some multiprecision types report it). The table then ends at the last
+  // B2n that is finite in T.
+  template <class T>
+  struct bernoulli_table_spans_range
+    : public mpl::bool_<   ((bernoulli_imp_variant<T>::value == 1) && (std::numeric_limits<T>::max_exponent ==   128))
+                        || ((bernoulli_imp_variant<T>::value == 2) && (std::numeric_limits<T>::max_exponent ==  1024))
+                        || (   (bernoulli_imp_variant<T>::value == 4)
+                            && (   (std::numeric_limits<T>::max_exponent == 16383)
+                                || (std::numeric_limits<T>::max_exponent == 16384)))> { };
+
+  template <class T>
+  std::size_t bernoulli_max_finite_index()
+  {
+    static const std::size_t index = bernoulli_max_finite_index_imp<T>(bernoulli_table_spans_range<T>());
+
+    return index;
+  }
+
+  // A finite value held as (-1)^negative 0.b1 b2 b3 ... 2^exponent, the
+  // binary digits of its mantissa in limbs of 28 bits, most significant
+  // first, and inexact set when digits were left out at the end. Caches of
+  // different types exchange entries in this form (see
+  // bernoulli_cache_registry): it holds the entries of binary types exactly,
+  // so that converting them to another type rounds only once.
+  class bernoulli_binary_value
+  {
+  public:
+    template <class U>
+    void assign(const U& x)
+    {
+      BOOST_MATH_STD_USING
+      using boost::math::itrunc;
+
+      m_negative = (x < 0);
+      m_limbs.clear();
+
+      U m = frexp((m_negative ? U(-x) : x), &m_exponent);
+
+      // For a decimal type the binary digits need not end: stop a limb
+      // past the precision of U.
+      for(int bits = 0; (m != 0) && (bits <= boost::math::tools::digits<U>()); bits += 28)
+      {
+        m = ldexp(m, 28);
+
+        const U limb = floor(m);
+
+        m_limbs.push_back(static_cast<boost::uint32_t>(itrunc(limb)));
+
+        m -= limb;
+      }
+
+      m_inexact = (m != 0);
+    }
+
+    // The value rounded to T: the leading digits of the mantissa, as many
+    // as T holds, are exact in T, and the rest is kept to 28 bits and a
+    // sticky bit that records whether any bits beyond were set. Adding the
+    // two in T then rounds as the full value would.
+    template <class T>
+    T value() const
+    {
+      BOOST_MATH_STD_USING
+
+      const int digits = boost::math::tools::digits<T>();
+
+      T               head(0);
+      boost::uint64_t tail      = 0U;
+      int             tail_bits = 0;
+      bool            sticky    = m_inexact;
+      int             bits      = 0;
+
+      for(std::size_t i = 0U; i < m_limbs.size(); ++i, bits += 28)
+      {
+        const int head_bits = (std::max)(0, (std::min)(28, digits - bits));
+
+        if(head_bits != 0)
+        {
+          head = ldexp(head, head_bits) + T(m_limbs[i] >> (28 - head_bits));
+        }
+
+        const int rest_bits = 28 - head_bits;
+
+        if(rest_bits != 0)
+        {
+          const boost::uint32_t rest = m_limbs[i] & ((boost::uint32_t(1U) << rest_bits) - 1U);
+
+          const int taken = (std::min)(rest_bits, 28 - tail_bits);
+
+          tail       = (tail << taken) | (rest >> (rest_bits - taken));
+          tail_bits += taken;
+          sticky     = (sticky || ((rest & ((boost::uint32_t(1U) << (rest_bits - taken)) - 1U)) != 0U));
+        }
+      }
+
+      if(bits < digits)
+      {
+        head = ldexp(head, digits - bits);
+      }
+
+      tail = (((tail << (28 - tail_bits)) << 1) | (sticky ? 1U : 0U));
+
+      const T result =   ldexp(head, m_exponent - digits)
+                       + ldexp(T(static_cast<boost::uint32_t>(tail)), m_exponent - digits - 29);
+
+      return (m_negative ? T(-result) : result);
+    }
+
+  private:
+    bool                         m_negative;
+    bool                         m_inexact;
+    int                          m_exponent;
+    std::vector<boost::uint32_t> m_limbs;
+  };
+
+  // A Bernoulli number cache whose entries other caches may round from,
+  // see bernoulli_cache_registry.
+  class bernoulli_cache_donor
+  {
+  public:
+    // The decimal digits of precision of the entries.
+    virtual int donor_digits10() const = 0;
+
+    // The decimal exponent range of the entries.
+    virtual int donor_max_exponent10() const = 0;
+
+    // The number of entries that may be read, none of which has overflowed.
+    virtual std::size_t donor_size() const = 0;
+
+    // Entry i, which must be below donor_size().
+    virtual void donor_entry(const std::size_t i, bernoulli_binary_value& value) const = 0;
+
+  protected:
+    ~bernoulli_cache_donor() { }
+  };
+
+  // The caches of the multiprecision types register here, so that a cache
+  // can fill entries already held by a cache of higher precision by rounding
+  // them, one conversion per entry, rather than running the tangent number
+  // recurrence, which costs O(n^2) operations. This pays off when one
+  // program uses several precisions, such as cpp_bin_float_50 alongside
+  // cpp_bin_float_100.
+  class bernoulli_cache_registry : private boost::noncopyable
+  {
+  public:
+    void add(const bernoulli_cache_donor* donor)
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      m_donors.push_back(donor);
+    }
+
+    void remove(const bernoulli_cache_donor* donor)
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      m_donors.erase(std::remove(m_donors.begin(), m_donors.end(), donor), m_donors.end());
+    }
+
+    // Rounds entries from first up to at most last into storage, from the
+    // largest registered cache holding at least three more decimal digits
+    // than T, whose every finite entry is also finite in T. Returns the
+    // index one past the last entry written.
+    template <class T>
+    std::size_t round_from(T* storage, const std::size_t first, const std::size_t last)
+    {
+      const bernoulli_cache_donor* donor      = 0;
+      std::size_t                  donor_size = first;
+
+      {
+        boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+        for(std::size_t i = 0U; i < m_donors.size(); ++i)
+        {
+          if(   (m_donors[i]->donor_digits10() >= std::numeric_limits<T>::digits10 + 3)
+             && (m_donors[i]->donor_max_exponent10() <= std::numeric_limits<T>::max_exponent10)
+             && (m_donors[i]->donor_size() > donor_size))
+          {
+            donor      = m_donors[i];
+            donor_size = donor->donor_size();
+          }
+        }
+      }
+
+      // The donor's first donor_size entries are published and will not
+      // change, and the donor, a cache of a type with a fixed precision,
+      // lives until the program exits: they are converted without holding
+      // up the other users of the registry.
+      const std::size_t end = (std::min)(last, donor_size);
+
+      bernoulli_binary_value value;
+
+      for(std::size_t i = first; i < end; ++i)
+      {
+        donor->donor_entry(i, value);
+
+        storage[i] = value.template value<T>();
+      }
+
+      return end;
+    }
+
+  private:
+    std::vector<const bernoulli_cache_donor*> m_donors;
+    boost::detail::lightweight_mutex          m_mutex;
+  };
+
+  inline bernoulli_cache_registry& get_bernoulli_cache_registry()
+  {
+    static bernoulli_cache_registry registry;
+    return registry;
+  }
+
+  // The Bernoulli number cache for type T, shared by every entry point that
+  // needs B2n (bernoulli_b2n, its series overload and the Stirling series
+  // in gamma.hpp), so that each value is computed, and held, only once.
+  // Readers of entries that have already been computed never take the lock,
+  // only growth of the cache is serialized.
+  //
+  // The tangent number generator is kept alongside the storage, so that
+  // growing the cache only performs the work for the new entries.
+  //
+  // The cache is independent of the caller's policy: values are generated
+  // with overflow errors ignored, the first index whose value overflowed is
+  // recorded, and callers raise their own overflow error for indices at or
+  // beyond that point.
+  //
+  // Optionally the cache is backed by a file (see attach_file), so that
+  // entries computed by one process are available to those that follow.
+  //
+  // The caches of the multiprecision types (those using the rational
+  // table) also share their entries through bernoulli_cache_registry.
+  template <class T>
+  class bernoulli_numbers_cache : private boost::noncopyable, private bernoulli_cache_donor
+  {
+  public:
+    typedef policies::policy<policies::overflow_error<policies::ignore_error> > policy_type;
+
+    typedef mpl::bool_<bernoulli_imp_variant<T>::value == 5> shares_entries_type;
+
+    bernoulli_numbers_cache() : m_overflow_index((std::numeric_limits<std::size_t>::max)())
+    {
+      register_donor(shares_entries_type());
+    }
+
+    ~bernoulli_numbers_cache()
+    {
+      unregister_donor(shares_entries_type());
+    }
+
+    // Ensure that B2n is available for all n in [0, count) and return
+    // a pointer to the first element. The pointer remains valid for at
+    // least count elements for the lifetime of the cache. Any growth
+    // needed may be spread over thread_count threads.
+    const T* ensure(const std::size_t count, const unsigned thread_count = 1U)
+    {
+      if(m_numbers.size() >= count)
+      {
+        return m_numbers.data();
+      }
+
+      std::size_t previous_size;
+      std::string file;
+
+      {
+        boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+        previous_size = m_numbers.size();
+
+        if(previous_size < count)
+        {
+          grow(previous_size, count, thread_count);
+
+          file = m_file;
+        }
+      }
+
+      // The new entries are published, and will not change: save them
+      // without holding up the other users of the cache.
+      if(!file.empty())
+      {
+        bernoulli_cache_file_append(file, m_numbers.data(), previous_size, count);
+      }
+
+      return m_numbers.data();
+    }
+
+    // As ensure, but never growing the cache past the last index at which
+    // B2n is finite in T, and raising no error when count reaches beyond it.
+    // Returns the number of entries available, all of them finite: count,
+    // or fewer when the range of T runs out first.
+    std::size_t ensure_available(const std::size_t count, const unsigned thread_count = 1U)
+    {
+      const std::size_t limit = (std::min)(count, bernoulli_max_finite_index<T>() + 1U);
+
+      static_cast<void>(ensure(limit, thread_count));
+
+      return (std::min)(limit, overflow_index());
+    }
+
+    // The number of entries that have been computed so far.
+    std::size_t size() const
+    {
+      return m_numbers.size();
+    }
+
+    // An estimate of the memory held by the entries.
+    std::size_t bytes() const
+    {
+      return m_numbers.size() * bernoulli_entry_bytes<T>();
+    }
+
+    // Load the entries saved in filename for this type and precision
+    // (see bernoulli_cache_file_read), and from then on keep the file up
+    // to date with every entry the cache holds. Returns the number of
+    // entries that were found in the file.
+    std::size_t attach_file(const std::string& filename)
+    {
+      std::vector<T> values;
+
+      bernoulli_cache_file_read(filename, values);
+
+      std::size_t size;
+
+      {
+        boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+        const std::size_t previous_size = m_numbers.size();
+
+        if(values.size() > previous_size)
+        {
+          // The tangent number generator is not advanced: should the cache
+          // grow beyond the file, it first catches up with the loaded rows.
+          T* storage = m_numbers.prepare(values.size());
+
+          std::copy(values.begin() + previous_size, values.end(), storage + previous_size);
+
+          record_overflow(storage, previous_size, values.size());
+
+          m_numbers.publish(storage, values.size());
+        }
+
+        m_file = filename;
+
+        size = m_numbers.size();
+      }
+
+      // Entries the cache held before, that the file lacked.
+      bernoulli_cache_file_append(filename, m_numbers.data(), values.size(), size);
+
+      return values.size();
+    }
+
+    // The smallest index n for which B2n has been found to overflow T,
+    // or the maximum value of std::size_t if no overflow has been seen yet.
+    std::size_t overflow_index() const
+    {
+      return m_overflow_index.acquire_load();
+    }
+
+  private:
+    void grow(const std::size_t previous_size, const std::size_t count, const unsigned thread_count)
+    {
+      // Called with the mutex held.
+      T* storage = m_numbers.prepare(count);
+
+      // Entries held in the compiled-in tables are copied rather than
+      // generated, the tangent number generator catches up on its own
+      // should the cache grow past them.
+      const std::size_t table_size = (std::min)(count, static_cast<std::size_t>(max_bernoulli_index<T>::value + 1U));
+
+      std::size_t first = previous_size;
+
+      for( ; first < table_size; ++first)
+      {
+        storage[first] = unchecked_bernoulli_b2n<T>(first);
+      }
+
+      first = round_from_donor(storage, first, count, shares_entries_type());
+
+      first = fill_past_table(storage, first, count, bernoulli_table_spans_range<T>());
+
+      if(first < count)
+      {
+        cache_imp<T>(first,
+                     count - first,
+                     storage + first,
+                     m_generator,
+                     policy_type(),
+                     thread_count);
+      }
+
+      record_overflow(storage, previous_size, count);
+
+      m_numbers.publish(storage, count);
+    }
+
+    void register_donor(const mpl::true_&)
+    {
+      get_bernoulli_cache_registry().add(this);
+    }
+
+    void register_donor(const mpl::false_&) { }
+
+    void unregister_donor(const mpl::true_&)
+    {
+      get_bernoulli_cache_registry().remove(this);
+    }
+
+    void unregister_donor(const mpl::false_&) { }
+
+    std::size_t round_from_donor(T* storage, const std::size_t first, const std::size_t last, const mpl::true_&)
+    {
+      return ((first < last) ? get_bernoulli_cache_registry().round_from(storage, first, last) : first);
+    }
+
+    std::size_t round_from_donor(T*, const std::size_t first, const std::size_t, const mpl::false_&)
+    {
+      return first;
+    }
+
+    // Past a table that reaches the overflow threshold of T every entry
+    // overflows: store the overflow values, of alternating sign, rather
+    // than running the tangent number recurrence only to find that out.
+    // Types that merely share the table go on to the generator.
+    std::size_t fill_past_table(T* storage, std::size_t first, const std::size_t last, const mpl::true_&)
+    {
+      const T overflow_value = (std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                                     : boost::math::tools::max_value<T>());
+
+      for( ; first < last; ++first)
+      {
+        storage[first] = (((first % 2U) != 0U) ? overflow_value : T(-overflow_value));
+      }
+
+      return last;
+    }
+
+    std::size_t fill_past_table(T*, const std::size_t first, const std::size_t, const mpl::false_&)
+    {
+      return first;
+    }
+
+    virtual int donor_digits10() const
+    {
+      return std::numeric_limits<T>::digits10;
+    }
+
+    virtual int donor_max_exponent10() const
+    {
+      return std::numeric_limits<T>::max_exponent10;
+    }
+
+    virtual std::size_t donor_size() const
+    {
+      return (std::min)(m_numbers.size(), m_overflow_index.acquire_load());
+    }
+
+    virtual void donor_entry(const std::size_t i, bernoulli_binary_value& value) const
+    {
+      value.assign(m_numbers.data()[i]);
+    }
+
+    void record_overflow(const T* storage, const std::size_t first, const std::size_t last)
+    {
+      if(m_overflow_index.acquire_load() == (std::numeric_limits<std::size_t>::max)())
+      {
+        for(std::size_t i = first; i < last; ++i)
+        {
+          if(   ((boost::math::isinf)(storage[i]))
+             || (boost::math::tools::max_value<T>() <= ((storage[i] < 0) ? T(-storage[i]) : storage[i])))
+          {
+            m_overflow_index.release_store(i);
+            break;
+          }
+        }
+      }
+    }
+
+    bernoulli_published_storage<T>    m_numbers;
+    bernoulli_atomic<std::size_t>     m_overflow_index;
+    tangent_numbers_generator<T>      m_generator;
+    std::string                       m_file;
+    boost::detail::lightweight_mutex  m_mutex;
+  };
+
+  // The caches of the types whose precision is set at run time register
+  // their stores here (see bernoulli_cache_store below), so that the memory
+  // held by all of them together can be kept within a budget,
+  // BOOST_MATH_BERNOULLI_CACHE_BYTES unless changed with set_budget, and so
+  // that all of them can be released at once.
+  class bernoulli_cache_store_base
+  {
+  public:
+    // An estimate of the memory held by the caches of the store.
+    virtual std::size_t bytes() = 0;
+
+    // Finds the least recently used cache that no thread holds, returning
+    // false if there is none.
+    virtual bool oldest_unpinned(boost::uintmax_t& last_use) = 0;
+
+    // Releases that cache, returning the estimate of the memory it held.
+    virtual std::size_t release_oldest_unpinned() = 0;
+
+    // Forgets every cache; each is released once no thread holds it.
+    virtual void release_all() = 0;
+
+  protected:
+    ~bernoulli_cache_store_base() { }
+  };
+
+  class bernoulli_cache_manager : private boost::noncopyable
+  {
+  public:
+    bernoulli_cache_manager() : m_budget(static_cast<std::size_t>(BOOST_MATH_BERNOULLI_CACHE_BYTES)),
+                                m_generation(0U),
+                                m_clock(0U) { }
+
+    void add(bernoulli_cache_store_base* store)
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      m_stores.push_back(store);
+    }
+
+    void remove(bernoulli_cache_store_base* store)
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      m_stores.erase(std::remove(m_stores.begin(), m_stores.end(), store), m_stores.end());
+    }
+
+    // Advances on every release_all: a thread holding a cache from an
+    // earlier generation lets go of it on its next call.
+    boost::uintmax_t generation() const
+    {
+      return m_generation.acquire_load();
+    }
+
+    // The clock by which the caches are ordered for release.
+    boost::uintmax_t tick()
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_clock_mutex);
+
+      return ++m_clock;
+    }
+
+    std::size_t set_budget(const std::size_t bytes)
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      const std::size_t previous_budget = m_budget;
+
+      m_budget = bytes;
+
+      return previous_budget;
+    }
+
+    // Releases the least recently used caches that no thread holds, of
+    // any type, until the total is within the budget.
+    void enforce_budget()
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      std::size_t total = 0U;
+
+      for(std::size_t i = 0U; i < m_stores.size(); ++i)
+      {
+        total += m_stores[i]->bytes();
+      }
+
+      while(total > m_budget)
+      {
+        bernoulli_cache_store_base* oldest_store = 0;
+        boost::uintmax_t            oldest_use   = 0U;
+
+        for(std::size_t i = 0U; i < m_stores.size(); ++i)
+        {
+          boost::uintmax_t last_use;
+
+          if(m_stores[i]->oldest_unpinned(last_use) && ((oldest_store == 0) || (last_use < oldest_use)))
+          {
+            oldest_store = m_stores[i];
+            oldest_use   = last_use;
+          }
+        }
+
+        if(oldest_store == 0)
+        {
+          break;
+        }
+
+        total -= (std::min)(total, oldest_store->release_oldest_unpinned());
+      }
+    }
+
+    void release_all()
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      m_generation.release_store(m_generation.acquire_load() + 1U);
+
+      for(std::size_t i = 0U; i < m_stores.size(); ++i)
+      {
+        m_stores[i]->release_all();
+      }
+    }
+
+  private:
+    std::vector<bernoulli_cache_store_base*> m_stores;
+    std::size_t                              m_budget;
+    bernoulli_atomic<boost::uintmax_t>       m_generation;
+    boost::uintmax_t                         m_clock;
+    boost::detail::lightweight_mutex         m_mutex;
+    boost::detail::lightweight_mutex         m_clock_mutex;
+  };
+
+  inline bernoulli_cache_manager& get_bernoulli_cache_manager()
+  {
+    static bernoulli_cache_manager manager;
+    return manager;
+  }
+
+  // Holds the caches of one kind for a type whose precision is set at run
+  // time, such as mpfr_float, one cache for each precision in use. The
+  // precision is tools::digits<T>(): entries computed at one precision
+  // are never handed out at another, and returning to an earlier precision
+  // finds its entries where it left them.
+  //
+  // Each thread holds on to the cache it used last, so pointers into a
+  // cache remain valid in the thread that obtained them until it uses the
+  // store at another precision, or after a call to release_all. Code that
+  // keeps pointers into a cache beyond that, from one call to the next,
+  // takes a share of it (see share below), or keeps it for good (see keep).
+  // Caches that no thread holds are released, least recently used first,
+  // whenever a thread moves to another cache and the caches of the store
+  // together hold more than BOOST_MATH_BERNOULLI_PRECISION_CACHE_BYTES, or
+  // those of all the stores more than the budget of bernoulli_cache_manager.
+  //
+  // This relies on thread_local: without it, no cache is ever released,
+  // not even by release_all, as other threads may be reading them.
+  template <class Cache>
+  class bernoulli_cache_store : private boost::noncopyable, private bernoulli_cache_store_base
+  {
+  public:
+    bernoulli_cache_store()
+    {
+      get_bernoulli_cache_manager().add(this);
+    }
+
+    ~bernoulli_cache_store()
+    {
+      get_bernoulli_cache_manager().remove(this);
+    }
+
+    Cache& get(const int digits)
+    {
+  #ifdef BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+      const pinned_cache& pin = pinned();
+
+      if(pin.cache && (pin.digits == digits) && (pin.generation == get_bernoulli_cache_manager().generation()))
+      {
+        return *pin.cache;
+      }
+  #endif
+
+      return *acquire(digits);
+    }
+
+    // As get, but sharing ownership of the cache, which then outlives a
+    // release or a move of this thread to another precision for as long
+    // as the caller keeps the share.
+    boost::shared_ptr<Cache> share(const int digits)
+    {
+  #ifdef BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+      const pinned_cache& pin = pinned();
+
+      if(pin.cache && (pin.digits == digits) && (pin.generation == get_bernoulli_cache_manager().generation()))
+      {
+        return pin.cache;
+      }
+  #endif
+
+      return acquire(digits);
+    }
+
+    // As get, but the cache is never released: pointers into it remain
+    // valid, in every thread, for the lifetime of the program.
+    Cache& keep(const int digits)
+    {
+      const boost::shared_ptr<Cache> cache = share(digits);
+
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      if(std::find(m_kept.begin(), m_kept.end(), cache) == m_kept.end())
+      {
+        m_kept.push_back(cache);
+      }
+
+      return *cache;
+    }
+
+  private:
+    struct entry
+    {
+      int                      digits;
+      boost::shared_ptr<Cache> cache;
+      boost::uintmax_t         last_use;
+    };
+
+    struct pinned_cache
+    {
+      pinned_cache() : digits(0), generation(0U) { }
+
+      int                      digits;
+      boost::uintmax_t         generation;
+      boost::shared_ptr<Cache> cache;
+    };
+
+  #ifdef BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+    static pinned_cache& pinned()
+    {
+      static thread_local pinned_cache pin;
+
+      return pin;
+    }
+  #endif
+
+    // Finds or creates the cache for digits, and pins it in this thread.
+    boost::shared_ptr<Cache> acquire(const int digits)
+    {
+      bernoulli_cache_manager& manager = get_bernoulli_cache_manager();
+
+  #ifdef BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+      pinned_cache& pin = pinned();
+
+      const boost::uintmax_t generation = manager.generation();
+  #endif
+
+      boost::shared_ptr<Cache> cache;
+
+      {
+        boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+        for(std::size_t i = 0U; i < m_entries.size(); ++i)
+        {
+          if(m_entries[i].digits == digits)
+          {
+            m_entries[i].last_use = manager.tick();
+
+            cache = m_entries[i].cache;
+          }
+        }
+
+        if(!cache)
+        {
+          cache.reset(new Cache());
+
+          const entry e = { digits, cache, manager.tick() };
+
+          m_entries.push_back(e);
+        }
+
+  #ifdef BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+        pin.digits     = digits;
+        pin.generation = generation;
+        pin.cache      = cache;
+
+        std::size_t total = bytes_imp();
+
+        while(total > static_cast<std::size_t>(BOOST_MATH_BERNOULLI_PRECISION_CACHE_BYTES))
+        {
+          const std::size_t released = release_oldest_unpinned_imp();
+
+          if(released == 0U)
+          {
+            break;
+          }
+
+          total -= (std::min)(total, released);
+        }
+  #endif
+      }
+
+  #ifdef BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+      // Not under the lock of this store: the manager takes the locks
+      // of all the stores in turn.
+      manager.enforce_budget();
+  #endif
+
+      return cache;
+    }
+
+    virtual std::size_t bytes()
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      return bytes_imp();
+    }
+
+    virtual bool oldest_unpinned(boost::uintmax_t& last_use)
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      const std::size_t oldest = oldest_unpinned_imp();
+
+      if(oldest == m_entries.size())
+      {
+        return false;
+      }
+
+      last_use = m_entries[oldest].last_use;
+
+      return true;
+    }
+
+    virtual std::size_t release_oldest_unpinned()
+    {
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      return release_oldest_unpinned_imp();
+    }
+
+    virtual void release_all()
+    {
+  #ifdef BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      m_entries.clear();
+  #endif
+    }
+
+    // The members below are called with the mutex held.
+    std::size_t bytes_imp() const
+    {
+      std::size_t total = 0U;
+
+      for(std::size_t i = 0U; i < m_entries.size(); ++i)
+      {
+        total += m_entries[i].cache->bytes();
+      }
+
+      return total;
+    }
+
+    std::size_t oldest_unpinned_imp() const
+    {
+      // A cache is held by a thread, other than through the entry, only
+      // by a pin; and it is only pinned with the mutex held.
+      std::size_t oldest = m_entries.size();
+
+      for(std::size_t i = 0U; i < m_entries.size(); ++i)
+      {
+        if(   (m_entries[i].cache.use_count() == 1)
+           && ((oldest == m_entries.size()) || (m_entries[i].last_use < m_entries[oldest].last_use)))
+        {
+          oldest = i;
+        }
+      }
+
+      return oldest;
+    }
+
+    std::size_t release_oldest_unpinned_imp()
+    {
+      const std::size_t oldest = oldest_unpinned_imp();
+
+      if(oldest == m_entries.size())
+      {
+        return 0U;
+      }
+
+      const std::size_t released = m_entries[oldest].cache->bytes();
+
+      m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(oldest));
+
+      return ((released != 0U) ? released : 1U);
+    }
+
+    std::vector<entry>                    m_entries;
+    std::vector<boost::shared_ptr<Cache> > m_kept;
+    boost::detail::lightweight_mutex      m_mutex;
+  };
+
+  template <class Cache>
+  inline bernoulli_cache_store<Cache>& get_bernoulli_cache_store()
+  {
+    static bernoulli_cache_store<Cache> store;
+    return store;
+  }
+
+  // The caches of types with a fixed precision are plain statics: there is
+  // one per type, bounded by the range of the type, and pointers into it,
+  // such as the views of bernoulli_b2n_view, remain valid for the lifetime
+  // of the program. Only the caches of types whose precision is set at run
+  // time, one for each precision in use, are held in a store.
+  template <class Cache, class T>
+  inline Cache& get_bernoulli_cache_imp(const mpl::true_&)
+  {
+    static Cache data;
+    return data;
+  }
+
+  template <class Cache, class T>
+  inline Cache& get_bernoulli_cache_imp(const mpl::false_&)
+  {
+    return get_bernoulli_cache_store<Cache>().get(boost::math::tools::digits<T>());
+  }
+
+  // The deleter of the shares of caches that are plain statics.
+  struct bernoulli_static_cache_deleter
+  {
+    void operator()(const void*) const { }
+  };
+
+  // As get_bernoulli_cache_imp, but sharing ownership of the cache, see
+  // bernoulli_cache_store::share.
+  template <class Cache, class T>
+  inline boost::shared_ptr<Cache> share_bernoulli_cache_imp(const mpl::true_&)
+  {
+    return boost::shared_ptr<Cache>(&get_bernoulli_cache_imp<Cache, T>(mpl::true_()), bernoulli_static_cache_deleter());
+  }
+
+  template <class Cache, class T>
+  inline boost::shared_ptr<Cache> share_bernoulli_cache_imp(const mpl::false_&)
+  {
+    return get_bernoulli_cache_store<Cache>().share(boost::math::tools::digits<T>());
+  }
+
+  // As get_bernoulli_cache_imp, but keeping the cache for the lifetime of
+  // the program, see bernoulli_cache_store::keep.
+  template <class Cache, class T>
+  inline Cache& keep_bernoulli_cache_imp(const mpl::true_&)
+  {
+    return get_bernoulli_cache_imp<Cache, T>(mpl::true_());
+  }
+
+  template <class Cache, class T>
+  inline Cache& keep_bernoulli_cache_imp(const mpl::false_&)
+  {
+    return get_bernoulli_cache_store<Cache>().keep(boost::math::tools::digits<T>());
+  }
+
+  template <class T>
+  bernoulli_numbers_cache<T>& get_bernoulli_numbers_cache()
+  {
+    return get_bernoulli_cache_imp<bernoulli_numbers_cache<T>, T>(mpl::bool_<std::numeric_limits<T>::is_specialized>());
+  }
+
+  template <class T>
+  boost::shared_ptr<bernoulli_numbers_cache<T> > share_bernoulli_numbers_cache()
+  {
+    return share_bernoulli_cache_imp<bernoulli_numbers_cache<T>, T>(mpl::bool_<std::numeric_limits<T>::is_specialized>());
+  }
+
+  template <class T>
+  bernoulli_numbers_cache<T>& keep_bernoulli_numbers_cache()
+  {
+    return keep_bernoulli_cache_imp<bernoulli_numbers_cache<T>, T>(mpl::bool_<std::numeric_limits<T>::is_specialized>());
+  }
+
+  template <class T, class Policy>
+  inline T bernoulli_overflow_value(const std::size_t index, const Policy& pol)
+  {
+    // The sign of B2n is (-1)^(n+1).
+    const T overflow_value = policies::raise_overflow_error<T>("boost::math::bernoulli<%1%>", "Overflow error while calculating Bernoulli number %1%", T(index), pol);
+
+    return (((index % 2U) != 0U) ? overflow_value : T(-overflow_value));
+  }
+
+  template <class T, class Policy>
+  void bernoulli_reserve_imp(const int max_index, const unsigned thread_count, const Policy& pol)
+  {
+    if(max_index < 0)
+    {
+      policies::raise_domain_error<T>("boost::math::bernoulli_b2n_reserve<%1%>", "Index should be >= 0 but got %1%", T(max_index), pol);
+      return;
+    }
+
+    static_cast<void>(tangent_numbers_min_overflow_index<T>());
+    static_cast<void>(get_bernoulli_numbers_cache<T>().ensure(static_cast<std::size_t>(max_index) + 1U, thread_count));
+  }
+
+  // When BOOST_MATH_BERNOULLI_INITIALIZER_MAX_INDEX is defined, the use of
+  // the Bernoulli numbers of type T anywhere in the program fills the cache
+  // for T up to that index before main() is entered, so that none of the
+  // one-off costs fall on the first caller. Otherwise this does nothing.
+  template <class T>
+  struct bernoulli_initializer
+  {
+    struct init
+    {
+      init()
+      {
+  #ifdef BOOST_MATH_BERNOULLI_INITIALIZER_MAX_INDEX
+        bernoulli_reserve_imp<T>(BOOST_MATH_BERNOULLI_INITIALIZER_MAX_INDEX, 1U, policies::policy<>());
+  #endif
+      }
+      void force_instantiate()const{}
+    };
+    static const init initializer;
+    static void force_instantiate()
+    {
+      initializer.force_instantiate();
+    }
+  };
+
+  template <class T>
+  const typename bernoulli_initializer<T>::init bernoulli_initializer<T>::initializer;
+
+  #ifndef BOOST_MATH_BERNOULLI_DIRECT_MIN_INDEX
+    #define BOOST_MATH_BERNOULLI_DIRECT_MIN_INDEX 500
+  #endif
+
+  // Returns m and sets e such that x = m * 2^e, with m in [0.5, 1),
+  // allowing products far outside the range of T to be accumulated.
+  template <class T>
+  inline T bernoulli_normalize(const T& x, long& e)
+  {
+    BOOST_MATH_STD_USING
+
+    int x_exponent;
+    const T m = frexp(x, &x_exponent);
+
+    e += x_exponent;
+
+    return m;
+  }
+
+  // Whether B2n for a single index far beyond the cache should be evaluated
+  // directly by bernoulli_b2n_direct_imp. That costs O(n) operations in place
+  // of the O(n^2) needed to grow the cache, but the rounding error of 2 pi is
+  // raised to the power 2n, costing about log2(4n) bits of the result. It is
+  // therefore only used when the policy asks for correspondingly fewer digits
+  // than T provides.
+  template <class T, class Policy>
+  inline bool bernoulli_use_direct_imp(const std::size_t index, const std::size_t cache_size, const Policy&)
+  {
+    if(   (index <= max_bernoulli_index<T>::value)
+       || (index < BOOST_MATH_BERNOULLI_DIRECT_MIN_INDEX)
+       || (index < cache_size * 2U))
+    {
+      return false;
+    }
+
+    int bits_lost = 4;
+
+    for(std::size_t k = index * 4U; k != 0U; k >>= 1)
+    {
+      ++bits_lost;
+    }
+
+    return (policies::digits<T, Policy>() + bits_lost <= boost::math::tools::digits<T>());
+  }
+
+  // Returns (2 pi)^two_n as m 2^e, with m in [0.5, 1), by binary powering.
+  template <class T>
+  T bernoulli_two_pi_power_normalized(const std::size_t two_n, long& e)
+  {
+    long e_base = 0;
+    T    m_pow(1);
+    T    m_base = bernoulli_normalize(boost::math::constants::two_pi<T>(), e_base);
+
+    for(std::size_t p = two_n; p != 0U; p >>= 1)
+    {
+      if((p & 1U) != 0U)
+      {
+        e     += e_base;
+        m_pow  = bernoulli_normalize(T(m_pow * m_base), e);
+      }
+
+      if(p > 1U)
+      {
+        e_base += e_base;
+        m_base  = bernoulli_normalize(T(m_base * m_base), e_base);
+      }
+    }
+
+    return m_pow;
+  }
+
+  // zeta(2n) = 1 + 2^(-2n) + 3^(-2n) + ..., for the large n used here.
+  template <class T, class Policy>
+  T bernoulli_zeta_two_n(const std::size_t two_n)
+  {
+    BOOST_MATH_STD_USING
+
+    T zeta_two_n(1);
+
+    const boost::uintmax_t max_iterations = policies::get_max_series_iterations<Policy>();
+
+    for(boost::uintmax_t k = 2U; k < max_iterations; ++k)
+    {
+      const T term = pow(T(k), -static_cast<int>(two_n));
+
+      zeta_two_n += term;
+
+      if(term <= zeta_two_n * boost::math::tools::epsilon<T>())
+      {
+        break;
+      }
+    }
+
+    return zeta_two_n;
+  }
+
+  // Evaluate a single B2n directly from
+  //
+  //   B2n = (-1)^(n+1) 2 (2n)! zeta(2n) / (2 pi)^(2n),
+  //
+  // in O(n) operations and O(1) memory. For the indices this is used for,
+  // the zeta series converges after very few terms. The result is returned
+  // as m 2^e, with |m| in [0.5, 1), so that it can't overflow.
+  template <class T, class Policy>
+  T bernoulli_b2n_direct_normalized(const std::size_t n, long& e, const Policy&)
+  {
+    BOOST_MATH_STD_USING
+
+    const std::size_t two_n = n * 2U;
+
+    // Accumulate (2n)! as m_fact * 2^e_fact. Consecutive factors are
+    // multiplied together exactly in an integer before being applied to
+    // the result, which reduces the number of roundings.
+    long e_fact = 0;
+    T    m_fact(1);
+
+    for(std::size_t k = 2U; k <= two_n; )
+    {
+      boost::uintmax_t chunk = 1U;
+
+      while((k <= two_n) && (chunk <= ((std::numeric_limits<boost::uint32_t>::max)() / k)))
+      {
+        chunk *= k;
+        ++k;
+      }
+
+      m_fact = bernoulli_normalize(T(m_fact * T(chunk)), e_fact);
+    }
+
+    // Accumulate (2 pi)^(2n) as m_pow * 2^e_pow.
+    long    e_pow = 0;
+    const T m_pow = bernoulli_two_pi_power_normalized<T>(two_n, e_pow);
+
+    const T zeta_two_n = bernoulli_zeta_two_n<T, Policy>(two_n);
+
+    e = (e_fact - e_pow) + 1L;
+
+    const T b = bernoulli_normalize(T((m_fact / m_pow) * zeta_two_n), e);
+
+    return (((n % 2U) != 0U) ? b : T(-b));
+  }
+
+  template <class T, class Policy>
+  T bernoulli_b2n_direct_imp(const std::size_t n, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING
+
+    long e = 0;
+
+    const T b = bernoulli_b2n_direct_normalized<T>(n, e, pol);
+
+    if((std::numeric_limits<T>::max_exponent > 0) && (e > std::numeric_limits<T>::max_exponent))
+    {
+      return bernoulli_overflow_value<T>(n, pol);
+    }
+
+    return ldexp(b, static_cast<int>(e));
+  }
+
+  // Returns x 2^e, or zero if that underflows, or the overflow value
+  // (of the sign of x) if it overflows.
+  template <class T, class Policy>
+  inline T bernoulli_denormalize(const T& x, long e, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING
+
+    const T m = bernoulli_normalize(x, e);
+
+    if((std::numeric_limits<T>::max_exponent > 0) && (e > std::numeric_limits<T>::max_exponent))
+    {
+      const T overflow_value = policies::raise_overflow_error<T>("boost::math::bernoulli<%1%>", "Overflow error while scaling Bernoulli number", pol);
+
+      return ((m < 0) ? T(-overflow_value) : overflow_value);
+    }
+
+    if(e < static_cast<long>((std::numeric_limits<int>::min)()))
+    {
+      return T(0);
+    }
+
+    return ldexp(m, static_cast<int>(e));
+  }
+
+  // The Bernoulli numbers scaled as they appear in asymptotic series:
+  //
+  //   B2n / (2n)!           (over_factorial), and
+  //   B2n / (2n (2n - 1))   (stirling, the coefficients of Stirling's
+  //                          series; entry 0 is zero),
+  //
+  // sharing the locking and publication scheme of bernoulli_numbers_cache.
+  // B2n / (2n)! decreases like 2 / (2 pi)^(2n), so unlike B2n it never
+  // overflows. Both are formed from the mantissas and exponents of B2n and
+  // (2n)!, so they are finite beyond the index at which B2n overflows T.
+  // There, B2n is evaluated from 2 (2n)! zeta(2n) / (2 pi)^(2n), advancing
+  // (2n)! and (2 pi)^(2n) from one entry to the next; the error grows like
+  // n eps, but such terms are negligible in any series that uses them.
+  template <class T>
+  class bernoulli_scaled_numbers_cache : private boost::noncopyable
+  {
+  public:
+    typedef typename bernoulli_numbers_cache<T>::policy_type policy_type;
+
+    bernoulli_scaled_numbers_cache() : m_fact(1), m_fact_exponent(0) { }
+
+    // Ensure that B2n / (2n)! is available for all n in [0, count)
+    // and return a pointer to the first element, as for
+    // bernoulli_numbers_cache::ensure.
+    const T* over_factorial(const std::size_t count)
+    {
+      ensure(count);
+
+      return m_over_factorial.data();
+    }
+
+    // Likewise for B2n / (2n (2n - 1)).
+    const T* stirling(const std::size_t count)
+    {
+      ensure(count);
+
+      return m_stirling.data();
+    }
+
+    // An estimate of the memory held by the entries of both sequences.
+    std::size_t bytes() const
+    {
+      return 2U * m_stirling.size() * bernoulli_entry_bytes<T>();
+    }
+
+  private:
+    void ensure(const std::size_t count)
+    {
+      // The sequences are published in the order m_over_factorial,
+      // m_stirling: checking the latter covers both.
+      if(m_stirling.size() >= count)
+      {
+        return;
+      }
+
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+      const std::size_t previous_size = m_stirling.size();
+
+      if(previous_size < count)
+      {
+        grow(previous_size, count);
+      }
+    }
+
+    void grow(const std::size_t previous_size, const std::size_t count)
+    {
+      // Called with the mutex held.
+      bernoulli_numbers_cache<T>& numbers = get_bernoulli_numbers_cache<T>();
+
+      const T*          bn             = numbers.ensure(count);
+      const std::size_t overflow_index = numbers.overflow_index();
+
+      T* over_factorial = m_over_factorial.prepare(count);
+      T* stirling       = m_stirling.prepare(count);
+
+      // (2n)! = fact 2^fact_exponent, advanced from (2 previous_size - 2)!.
+      T    fact          = m_fact;
+      long fact_exponent = m_fact_exponent;
+
+      // Past the overflow index, (2 pi)^(2n) = two_pi_pow 2^two_pi_pow_exponent,
+      // obtained by binary powering at the first such n and then advanced
+      // by (2 pi)^2 at each step.
+      long    two_pi_squared_exponent = 0;
+      const T two_pi_squared          = bernoulli_two_pi_power_normalized<T>(2U, two_pi_squared_exponent);
+
+      T    two_pi_pow(0);
+      long two_pi_pow_exponent = 0;
+
+      for(std::size_t n = previous_size; n < count; ++n)
+      {
+        if(n == 0U)
+        {
+          over_factorial[n] = T(1);
+          stirling[n]       = T(0);
+          continue;
+        }
+
+        const boost::uintmax_t two_n_two_n_minus_one = static_cast<boost::uintmax_t>(2U * n) * static_cast<boost::uintmax_t>((2U * n) - 1U);
+
+        fact = bernoulli_normalize(T(fact * T(two_n_two_n_minus_one)), fact_exponent);
+
+        long b_exponent = 0;
+        T    b;
+
+        if(n < overflow_index)
+        {
+          b = bernoulli_normalize(bn[n], b_exponent);
+        }
+        else
+        {
+          // B2n = (-1)^(n+1) 2 (2n)! zeta(2n) / (2 pi)^(2n), as in
+          // bernoulli_b2n_direct_normalized but in O(1) operations per
+          // entry, reusing (2n)! from above.
+          if(two_pi_pow == 0)
+          {
+            two_pi_pow = bernoulli_two_pi_power_normalized<T>(2U * n, two_pi_pow_exponent);
+          }
+          else
+          {
+            two_pi_pow_exponent += two_pi_squared_exponent;
+            two_pi_pow           = bernoulli_normalize(T(two_pi_pow * two_pi_squared), two_pi_pow_exponent);
+          }
+
+          b_exponent = (fact_exponent - two_pi_pow_exponent) + 1L;
+          b          = bernoulli_normalize(T((fact / two_pi_pow) * bernoulli_zeta_two_n<T, policy_type>(2U * n)), b_exponent);
+
+          if((n % 2U) == 0U)
+          {
+            b = -b;
+          }
+        }
+
+        over_factorial[n] = bernoulli_denormalize(T(b / fact), b_exponent - fact_exponent, policy_type());
+        stirling[n]       = bernoulli_denormalize(T(b / T(two_n_two_n_minus_one)), b_exponent, policy_type());
+      }
+
+      m_over_factorial.publish(over_factorial, count);
+      m_stirling.publish(stirling, count);
+
+      m_fact          = fact;
+      m_fact_exponent = fact_exponent;
+    }
+
+    bernoulli_published_storage<T>    m_over_factorial;
+    bernoulli_published_storage<T>    m_stirling;
+    T                                 m_fact;
+    long                              m_fact_exponent;
+    boost::detail::lightweight_mutex  m_mutex;
+  };
+
+  template <class T>
+  bernoulli_scaled_numbers_cache<T>& get_bernoulli_scaled_numbers_cache()
+  {
+    return get_bernoulli_cache_imp<bernoulli_scaled_numbers_cache<T>, T>(mpl::bool_<std::numeric_limits<T>::is_specialized>());
+  }
+
+  template <class T>
+  boost::shared_ptr<bernoulli_scaled_numbers_cache<T> > share_bernoulli_scaled_numbers_cache()
+  {
+    return share_bernoulli_cache_imp<bernoulli_scaled_numbers_cache<T>, T>(mpl::bool_<std::numeric_limits<T>::is_specialized>());
+  }
+
+  template <class T, class Policy>
+  T bernoulli_number_imp(const int n, const Policy &pol)
+  {
+    if(n < 0)
+    {
+      return policies::raise_domain_error<T>("boost::math::bernoulli<%1%>", "Index should be >= 0 but got %1%", T(n/2), Policy());
+    }
+
+    bernoulli_initializer<T>::force_instantiate();
+
+    const std::size_t index = static_cast<std::size_t>(n / 2);
+
+    bernoulli_numbers_cache<T>& cache = get_bernoulli_numbers_cache<T>();
+
+    if(bernoulli_use_direct_imp<T>(index, cache.size(), pol))
+    {
+      // A single value far beyond the cache: don't build
+      // the whole table up to it.
+      return bernoulli_b2n_direct_imp<T>(index, pol);
+    }
+
+    const T* bn = cache.ensure(index + 1U);
+
+    return ((index < cache.overflow_index()) ? bn[index] : bernoulli_overflow_value<T>(index, pol));
+  }
+
+  template <class T, class Policy>
+  inline boost::iterator_range<const T*> bernoulli_view_imp(int start_index,
+                                                            unsigned number_of_bernoullis_bn,
+                                                            const Policy& pol)
+  {
+    if(start_index < 0)
+    {
+       policies::raise_domain_error<T>("boost::math::bernoulli<%1%>", "Start Index should be >= 0 but got %1%", T(start_index), Policy());
+       return boost::iterator_range<const T*>(static_cast<const T*>(0), static_cast<const T*>(0));
+    }
+
+    bernoulli_initializer<T>::force_instantiate();
+
+    const std::size_t start = static_cast<std::size_t>(start_index);
+    const std::size_t last  = start + number_of_bernoullis_bn;
+
+    bernoulli_numbers_cache<T>& cache = keep_bernoulli_numbers_cache<T>();
+
+    const T* bn = cache.ensure(last);
+
+    if(last > cache.overflow_index())
+    {
+      // The entries from the overflow index on hold the overflow value
+      // of the cache's own policy: let the caller's policy have its say.
+      static_cast<void>(bernoulli_overflow_value<T>((std::max)(start, cache.overflow_index()), pol));
+    }
+
+    return boost::iterator_range<const T*>(bn + start, bn + last);
+  }
+
+  template <class T, class OutputIterator, class Policy>
+  inline OutputIterator bernoulli_series_imp(int start_index,
+                                             unsigned number_of_bernoullis_bn,
+                                             OutputIterator out_it,
+                                             const Policy& pol)
+  {
+    if(start_index < 0)
+    {
+       policies::raise_domain_error<T>("boost::math::bernoulli<%1%>", "Start Index should be >= 0 but got %1%", T(start_index), Policy());
+       return out_it;
+    }
+
+    bernoulli_initializer<T>::force_instantiate();
+
+    const std::size_t start = static_cast<std::size_t>(start_index);
+    const std::size_t last  = start + number_of_bernoullis_bn;
+
+    bernoulli_numbers_cache<T>& cache = get_bernoulli_numbers_cache<T>();
+
+    const T* bn = cache.ensure(last);
+
+    const std::size_t first_overflow = (std::max)(start, (std::min)(last, cache.overflow_index()));
+
+    out_it = std::copy(bn + start, bn + first_overflow, out_it);
+
+    for(std::size_t i = first_overflow; i < last; ++i)
+    {
+      *out_it = bernoulli_overflow_value<T>(i, pol);
+      ++out_it;
+    }
+
+    return out_it;
+  }
+
+  // Selects the compiled-in table used for T:
+  // 1: float sized types, 2: double and long double with a 1024 exponent range,
+  // 4: types with the exponent range of 80-bit long double and quad precision
+  // (some multiprecision types report 16383 rather than 16384) and no more
+  // than 113 bits of precision; a wider exponent range would hold finite
+  // values past the end of the table, and is left to variant 5,
+  // 5: other types whose exponent range holds B618, such as the multiprecision
+  // types, which round the exact rationals of bernoulli_rational_data,
+  // 3: everything else (the exact rationals that fit in 64-bit integers).
+  template <class T>
+  struct bernoulli_imp_variant
+  {
+    BOOST_STATIC_CONSTANT(int, value =
+        (   (std::numeric_limits<T>::max_exponent >= 128)
+         && (std::numeric_limits<T>::max_exponent < 1024)
+         && (std::numeric_limits<T>::digits10 <= std::numeric_limits<float>::digits10)
+         && boost::is_convertible<T, float>::value) ? 1 :
+        (   (std::numeric_limits<T>::max_exponent >= 16383)
+         && (std::numeric_limits<T>::max_exponent <= 16384)
+         && (std::numeric_limits<T>::digits10 <= 33)
+         && (std::numeric_limits<T>::radix == 2)) ? 4 :
+        (   (std::numeric_limits<T>::max_exponent >= 1024)
+         && (std::numeric_limits<T>::digits10 <= std::numeric_limits<long double>::digits10)
+         && boost::is_convertible<T, long double>::value) ? 2 :
+        (   std::numeric_limits<T>::is_specialized
+         && (std::numeric_limits<T>::max_exponent10 > 965)) ? 5 : 3);
+  };
+
+  template <class T>
+  struct max_bernoulli_index
+  {
+    BOOST_STATIC_CONSTANT(unsigned, value =
+        (bernoulli_imp_variant<T>::value == 1) ?   31U :
+        (bernoulli_imp_variant<T>::value == 2) ?  129U :
+        (bernoulli_imp_variant<T>::value == 4) ? 1156U :
+        (bernoulli_imp_variant<T>::value == 5) ?  309U : 17U);
+  };
+
+  // The compiled-in tables are static data members of class templates rather
+  // than function local statics: there is no initialisation guard to test on
+  // each call and, where the compiler supports C++14 constexpr, they can be
+  // read in constant expressions through unchecked_bernoulli_b2n. Unlike
+  // constants at namespace scope, which have internal linkage, each table has
+  // a single definition shared by every translation unit. The Dummy parameter
+  // only serves to make them templates. The members are declared const and
+  // defined with BOOST_CONSTEXPR_OR_CONST, as a constexpr member would need
+  // its initializer inside the class.
+  template <class Dummy = void>
+  struct bernoulli_int64_data
+  {
+    static const boost::int64_t numerators[18U];
+    static const boost::int64_t denominators[18U];
+  };
+
+  template <class Dummy>
+  BOOST_CONSTEXPR_OR_CONST boost::int64_t bernoulli_int64_data<Dummy>::numerators[18U] =
+  {
+                +1LL,
+                +1LL,
+                -1LL,
+                +1LL,
+                -1LL,
+                +5LL,
+              -691LL,
+                +7LL,
+             -3617LL,
+            +43867LL,
+           -174611LL,
+           +854513LL,
+        -236364091LL,
+          +8553103LL,
+      -23749461029LL,
+    +8615841276005LL,
+    -7709321041217LL,
+    +2577687858367LL
+  };
+
+  template <class Dummy>
+  BOOST_CONSTEXPR_OR_CONST boost::int64_t bernoulli_int64_data<Dummy>::denominators[18U] =
+  {
+        1LL,
+        6LL,
+       30LL,
+       42LL,
+       30LL,
+       66LL,
+     2730LL,
+        6LL,
+      510LL,
+      798LL,
+      330LL,
+      138LL,
+     2730LL,
+        6LL,
+      870LL,
+    14322LL,
+      510LL,
+        6LL
+  };
+
+  template <class Dummy = void>
+  struct bernoulli_float_data
+  {
+    static const float values[32U];
+  };
+
+  template <class Dummy>
+  BOOST_CONSTEXPR_OR_CONST float bernoulli_float_data<Dummy>::values[32U] =
+  {
+    +1.00000000000000000000000000000000000000000F,
+    +0.166666666666666666666666666666666666666667F,
+    -0.0333333333333333333333333333333333333333333F,
+    +0.0238095238095238095238095238095238095238095F,
+    -0.0333333333333333333333333333333333333333333F,
+    +0.0757575757575757575757575757575757575757576F,
+    -0.253113553113553113553113553113553113553114F,
+    +1.16666666666666666666666666666666666666667F,
+    -7.09215686274509803921568627450980392156863F,
+    +54.9711779448621553884711779448621553884712F,
+    -529.124242424242424242424242424242424242424F,
+    +6192.12318840579710144927536231884057971014F,
+    -86580.2531135531135531135531135531135531136F,
+    +1.42551716666666666666666666666666666666667E6F,
+    -2.72982310678160919540229885057471264367816E7F,
+    +6.01580873900642368384303868174835916771401E8F,
+    -1.51163157670921568627450980392156862745098E10F,
+    +4.29614643061166666666666666666666666666667E11F,
+    -1.37116552050883327721590879485616327721591E13F,
+    +4.88332318973593166666666666666666666666667E14F,
+    -1.92965793419400681486326681448632668144863E16F,
+    +8.41693047573682615000553709856035437430786E17F,
+    -4.03380718540594554130768115942028985507246E19F,
+    +2.11507486380819916056014539007092198581560E21F,
+    -1.20866265222965259346027311937082525317819E23F,
+    +7.50086674607696436685572007575757575757576E24F,
+    -5.03877810148106891413789303052201257861635E26F,
+    +3.65287764848181233351104308429711779448622E28F,
+    -2.84987693024508822262691464329106781609195E30F,
+    +2.38654274996836276446459819192192149717514E32F,
+    -2.13999492572253336658107447651910973926742E34F,
+    +2.05009757234780975699217330956723102516667E36F
+  };
+
+  template <class Dummy = void>
+  struct bernoulli_long_double_data
+  {
+    static const long double values[130U];
+  };
+
+  template <class Dummy>
+  BOOST_CONSTEXPR_OR_CONST long double bernoulli_long_double_data<Dummy>::values[130U] =
+  {
+    +1.00000000000000000000000000000000000000000L,
+    +0.166666666666666666666666666666666666666667L,
+    -0.0333333333333333333333333333333333333333333L,
+    +0.0238095238095238095238095238095238095238095L,
+    -0.0333333333333333333333333333333333333333333L,
+    +0.0757575757575757575757575757575757575757576L,
+    -0.253113553113553113553113553113553113553114L,
+    +1.16666666666666666666666666666666666666667L,
+    -7.09215686274509803921568627450980392156863L,
+    +54.9711779448621553884711779448621553884712L,
+    -529.124242424242424242424242424242424242424L,
+    +6192.12318840579710144927536231884057971014L,
+    -86580.2531135531135531135531135531135531136L,
+    +1.42551716666666666666666666666666666666667E6L,
+    -2.72982310678160919540229885057471264367816E7L,
+    +6.01580873900642368384303868174835916771401E8L,
+    -1.51163157670921568627450980392156862745098E10L,
+    +4.29614643061166666666666666666666666666667E11L,
+    -1.37116552050883327721590879485616327721591E13L,
+    +4.88332318973593166666666666666666666666667E14L,
+    -1.92965793419400681486326681448632668144863E16L,
+    +8.41693047573682615000553709856035437430786E17L,
+    -4.03380718540594554130768115942028985507246E19L,
+    +2.11507486380819916056014539007092198581560E21L,
+    -1.20866265222965259346027311937082525317819E23L,
+    +7.50086674607696436685572007575757575757576E24L,
+    -5.03877810148106891413789303052201257861635E26L,
+    +3.65287764848181233351104308429711779448622E28L,
+    -2.84987693024508822262691464329106781609195E30L,
+    +2.38654274996836276446459819192192149717514E32L,
+    -2.13999492572253336658107447651910973926742E34L,
+    +2.05009757234780975699217330956723102516667E36L,
+    -2.09380059113463784090951852900279701847092E38L,
+    +2.27526964884635155596492603527692645814700E40L,
+    -2.62577102862395760473030497361582020814490E42L,
+    +3.21250821027180325182047923042649852435219E44L,
+    -4.15982781667947109139170744952623589366896E46L,
+    +5.69206954820352800238834562191210586444805E48L,
+    -8.21836294197845756922906534686173330145509E50L,
+    +1.25029043271669930167323398297028955241772E53L,
+    -2.00155832332483702749253291988132987687242E55L,
+    +3.36749829153643742333966769033387530162196E57L,
+    -5.94709705031354477186604968440515408405791E59L,
+    +1.10119103236279775595641307904376916046305E62L,
+    -2.13552595452535011886583850190410656789733E64L,
+    +4.33288969866411924196166130593792062184514E66L,
+    -9.18855282416693282262005552155018971389604E68L,
+    +2.03468967763290744934550279902200200659751E71L,
+    -4.70038339580357310785752555350060606545967E73L,
+    +1.13180434454842492706751862577339342678904E76L,
+    -2.83822495706937069592641563364817647382847E78L,
+    +7.40642489796788506297508271409209841768797E80L,
+    -2.00964548027566044834656196727153631868673E83L,
+    +5.66571700508059414457193460305193569614195E85L,
+    -1.65845111541362169158237133743199123014950E88L,
+    +5.03688599504923774192894219151801548124424E90L,
+    -1.58614682376581863693634015729664387827410E93L,
+    +5.17567436175456269840732406825071225612408E95L,
+    -1.74889218402171173396900258776181591451415E98L,
+    +6.11605199949521852558245252642641677807677E100L,
+    -2.21227769127078349422883234567129324455732E103L,
+    +8.27227767987709698542210624599845957312047E105L,
+    -3.19589251114157095835916343691808148735263E108L,
+    +1.27500822233877929823100243029266798669572E111L,
+    -5.25009230867741338994028246245651754469199E113L,
+    +2.23018178942416252098692981988387281437383E116L,
+    -9.76845219309552044386335133989802393011669E118L,
+    +4.40983619784529542722726228748131691918758E121L,
+    -2.05085708864640888397293377275830154864566E124L,
+    +9.82144332797912771075729696020975210414919E126L,
+    -4.84126007982088805087891967099634127611305E129L,
+    +2.45530888014809826097834674040886903996737E132L,
+    -1.28069268040847475487825132786017857218118E135L,
+    +6.86761671046685811921018885984644004360924E137L,
+    -3.78464685819691046949789954163795568144895E140L,
+    +2.14261012506652915508713231351482720966602E143L,
+    -1.24567271371836950070196429616376072194583E146L,
+    +7.43457875510001525436796683940520613117807E148L,
+    -4.55357953046417048940633332233212748767721E151L,
+    +2.86121128168588683453638472510172325229190E154L,
+    -1.84377235520338697276882026536287854875414E157L,
+    +1.21811545362210466995013165065995213558174E160L,
+    -8.24821871853141215484818457296893447301419E162L,
+    +5.72258779378329433296516498142978615918685E165L,
+    -4.06685305250591047267679693831158655602196E168L,
+    +2.95960920646420500628752695815851870426379E171L,
+    -2.20495225651894575090311752273445984836379E174L,
+    +1.68125970728895998058311525151360665754464E177L,
+    -1.31167362135569576486452806355817153004431E180L,
+    +1.04678940094780380821832853929823089643829E183L,
+    -8.54328935788337077185982546299082774593270E185L,
+    +7.12878213224865423522884066771438224721245E188L,
+    -6.08029314555358993000847118686477458461988E191L,
+    +5.29967764248499239300942910043247266228490E194L,
+    -4.71942591687458626443646229013379911103761E197L,
+    +4.29284137914029810894168296541074669045521E200L,
+    -3.98767449682322074434477655542938795106651E203L,
+    +3.78197804193588827138944181161393327898220E206L,
+    -3.66142336836811912436858082151197348755196E209L,
+    +3.61760902723728623488554609298914089477541E212L,
+    -3.64707726451913543621383088655499449048682E215L,
+    +3.75087554364544090983452410104814189306842E218L,
+    -3.93458672964390282694891288533713429355657E221L,
+    +4.20882111481900820046571171111494898242731E224L,
+    -4.59022962206179186559802940573325591059371E227L,
+    +5.10317257726295759279198185106496768539760E230L,
+    -5.78227623036569554015377271242917142512200E233L,
+    +6.67624821678358810322637794412809363451080E236L,
+    -7.85353076444504163225916259639312444428230E239L,
+    +9.41068940670587255245443288258762485293948E242L,
+    -1.14849338734651839938498599206805592548354E246L,
+    +1.42729587428487856771416320087122499897180E249L,
+    -1.80595595869093090142285728117654560926719E252L,
+    +2.32615353076608052161297985184708876161736E255L,
+    -3.04957517154995947681942819261542593785327E258L,
+    +4.06858060764339734424012124124937318633684E261L,
+    -5.52310313219743616252320044093186392324280E264L,
+    +7.62772793964343924869949690204961215533859E267L,
+    -1.07155711196978863132793524001065396932667E271L,
+    +1.53102008959691884453440916153355334355847E274L,
+    -2.22448916821798346676602348865048510824835E277L,
+    +3.28626791906901391668189736436895275365183E280L,
+    -4.93559289559603449020711938191575963496999E283L,
+    +7.53495712008325067212266049779283956727824E286L,
+    -1.16914851545841777278088924731655041783900E290L,
+    +1.84352614678389394126646201597702232396492E293L,
+    -2.95368261729680829728014917350525183485207E296L,
+    +4.80793212775015697668878704043264072227967E299L,
+    -7.95021250458852528538243631671158693036798E302L,
+    +1.33527841873546338750122832017820518292039E306L
+  };
+
+  struct bernoulli_big_entry
+  {
+    tools::largest_float value;
+    const char*          text;
+  };
+
+  #define BOOST_MATH_BERNOULLI_BIG_ENTRY(x) { BOOST_MATH_LARGEST_FLOAT_C(x), BOOST_STRINGIZE(x) }
+
+  // B2n rounded to 42 significant digits, every entry is correctly rounded
+  // at 113 bits.  B2312 is the last one below 2^16384.
+  template <class Dummy = void>
+  struct bernoulli_big_data
+  {
+    static const bernoulli_big_entry entries[1157U];
+  };
+
+  template <class Dummy>
+  BOOST_CONSTEXPR_OR_CONST bernoulli_big_entry bernoulli_big_data<Dummy>::entries[1157U] =
+  {
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.00000000000000000000000000000000000000000),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+0.166666666666666666666666666666666666666667),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-0.0333333333333333333333333333333333333333333),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+0.0238095238095238095238095238095238095238095),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-0.0333333333333333333333333333333333333333333),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+0.0757575757575757575757575757575757575757576),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-0.253113553113553113553113553113553113553114),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.16666666666666666666666666666666666666667),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.09215686274509803921568627450980392156863),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+54.9711779448621553884711779448621553884712),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-529.124242424242424242424242424242424242424),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6192.12318840579710144927536231884057971014),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-86580.2531135531135531135531135531135531136),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.42551716666666666666666666666666666666667E6),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.72982310678160919540229885057471264367816E7),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.01580873900642368384303868174835916771401E8),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.51163157670921568627450980392156862745098E10),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.29614643061166666666666666666666666666667E11),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.37116552050883327721590879485616327721591E13),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.88332318973593166666666666666666666666667E14),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.92965793419400681486326681448632668144863E16),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.41693047573682615000553709856035437430786E17),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.03380718540594554130768115942028985507246E19),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.11507486380819916056014539007092198581560E21),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.20866265222965259346027311937082525317819E23),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.50086674607696436685572007575757575757576E24),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.03877810148106891413789303052201257861635E26),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.65287764848181233351104308429711779448622E28),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.84987693024508822262691464329106781609195E30),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.38654274996836276446459819192192149717514E32),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.13999492572253336658107447651910973926742E34),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.05009757234780975699217330956723102516667E36),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.09380059113463784090951852900279701847092E38),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.27526964884635155596492603527692645814700E40),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.62577102862395760473030497361582020814490E42),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.21250821027180325182047923042649852435219E44),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.15982781667947109139170744952623589366896E46),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.69206954820352800238834562191210586444805E48),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.21836294197845756922906534686173330145509E50),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.25029043271669930167323398297028955241772E53),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.00155832332483702749253291988132987687242E55),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.36749829153643742333966769033387530162196E57),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.94709705031354477186604968440515408405791E59),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.10119103236279775595641307904376916046305E62),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.13552595452535011886583850190410656789733E64),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.33288969866411924196166130593792062184514E66),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.18855282416693282262005552155018971389604E68),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.03468967763290744934550279902200200659751E71),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.70038339580357310785752555350060606545967E73),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.13180434454842492706751862577339342678904E76),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.83822495706937069592641563364817647382847E78),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.40642489796788506297508271409209841768797E80),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.00964548027566044834656196727153631868673E83),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.66571700508059414457193460305193569614195E85),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.65845111541362169158237133743199123014950E88),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.03688599504923774192894219151801548124424E90),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.58614682376581863693634015729664387827410E93),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.17567436175456269840732406825071225612408E95),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.74889218402171173396900258776181591451415E98),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.11605199949521852558245252642641677807677E100),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.21227769127078349422883234567129324455732E103),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.27227767987709698542210624599845957312047E105),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.19589251114157095835916343691808148735263E108),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.27500822233877929823100243029266798669572E111),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.25009230867741338994028246245651754469199E113),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.23018178942416252098692981988387281437383E116),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.76845219309552044386335133989802393011669E118),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.40983619784529542722726228748131691918758E121),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.05085708864640888397293377275830154864566E124),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.82144332797912771075729696020975210414919E126),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.84126007982088805087891967099634127611305E129),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.45530888014809826097834674040886903996737E132),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.28069268040847475487825132786017857218118E135),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.86761671046685811921018885984644004360924E137),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.78464685819691046949789954163795568144895E140),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.14261012506652915508713231351482720966602E143),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.24567271371836950070196429616376072194583E146),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.43457875510001525436796683940520613117807E148),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.55357953046417048940633332233212748767721E151),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.86121128168588683453638472510172325229190E154),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.84377235520338697276882026536287854875414E157),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.21811545362210466995013165065995213558174E160),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.24821871853141215484818457296893447301419E162),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.72258779378329433296516498142978615918685E165),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.06685305250591047267679693831158655602196E168),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.95960920646420500628752695815851870426379E171),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.20495225651894575090311752273445984836379E174),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.68125970728895998058311525151360665754464E177),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.31167362135569576486452806355817153004431E180),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.04678940094780380821832853929823089643829E183),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.54328935788337077185982546299082774593270E185),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.12878213224865423522884066771438224721245E188),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.08029314555358993000847118686477458461988E191),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.29967764248499239300942910043247266228490E194),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.71942591687458626443646229013379911103761E197),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.29284137914029810894168296541074669045521E200),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.98767449682322074434477655542938795106651E203),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.78197804193588827138944181161393327898220E206),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.66142336836811912436858082151197348755196E209),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.61760902723728623488554609298914089477541E212),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.64707726451913543621383088655499449048682E215),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.75087554364544090983452410104814189306842E218),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.93458672964390282694891288533713429355657E221),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.20882111481900820046571171111494898242731E224),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.59022962206179186559802940573325591059371E227),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.10317257726295759279198185106496768539760E230),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.78227623036569554015377271242917142512200E233),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.67624821678358810322637794412809363451080E236),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.85353076444504163225916259639312444428230E239),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.41068940670587255245443288258762485293948E242),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.14849338734651839938498599206805592548354E246),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.42729587428487856771416320087122499897180E249),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.80595595869093090142285728117654560926719E252),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.32615353076608052161297985184708876161736E255),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.04957517154995947681942819261542593785327E258),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.06858060764339734424012124124937318633684E261),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.52310313219743616252320044093186392324280E264),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.62772793964343924869949690204961215533859E267),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.07155711196978863132793524001065396932667E271),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.53102008959691884453440916153355334355847E274),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.22448916821798346676602348865048510824835E277),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.28626791906901391668189736436895275365183E280),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.93559289559603449020711938191575963496999E283),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.53495712008325067212266049779283956727824E286),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.16914851545841777278088924731655041783900E290),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.84352614678389394126646201597702232396492E293),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.95368261729680829728014917350525183485207E296),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.80793212775015697668878704043264072227967E299),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.95021250458852528538243631671158693036798E302),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.33527841873546338750122832017820518292039E306),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.27764064960195959387505898350693803701873E309),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.94518403604632623416352555642266759588367E312),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.93852577213060210607172498964140555047312E315),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.23889636757756482372905782021921092998572E319),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.24554259916930975949998796602560448074547E322),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.13121317607384235973251163948966940426617E325),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.71358134681526958496092806976288277136898E328),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.46153606683766960063861378847133554131340E332),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.80990460622553289686293564299271205963129E335),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.48095712131887663951209699441399228432718E338),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.08457328408768611051812529118607961632025E342),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.17698077564766353972916517386371645996207E345),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.43199878611755375194743943325675260806826E348),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.15062565771553504741775627807377009607300E351),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.91586735300315735131657757914868313361329E355),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.06725630354221225869883600368201604062882E358),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.75422379103773661622815020991034873462920E361),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.91017368873553366724437374712410937982572E365),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.22500132026509171463111506471317440460727E368),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.47195935254782767846677079678750303450542E371),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.15214997327998682971981737675608819857346E375),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.95548577533422105134483971650781287136099E378),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.15622594175913469663095688971638196814176E382),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.73340659764613769861099192670509851401702E385),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.54686813532517694709991252327993854633279E388),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.58852491244122147281469212106982169554714E392),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.90435480086171518021859815105019184130830E395),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.71993868609204578182727341166813297531893E398),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.45076362104952205123447973751137567928270E402),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.25789209839681530508567412633431709527695E405),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.61811355208380659252798953163695508442041E409),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.23652879521761835734861861321683372264840E412),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.12304706819905100808617498912413687899218E416),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.01397178752565477021728355939228666688604E419),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.18843757322155303037568142920296907042034E422),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.25191059133671680915395814672577571870720E426),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.26841129204378982307531415150913941339915E429),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.76599084520232264269357211251131247152713E433),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.03515443623133165125907129673116088223957E436),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.45277935646048324525376535666440220726573E440),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.24149089013013733905241496068415151516563E443),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.25296600169242777408829383333884189329317E447),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.74483004747827294797810322787674724034259E450),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.13231580669571093059587600108923221602359E454),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.46351084594270180599178619777393466257801E457),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.07164338264967557208686546587391661153659E461),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.35382447543993368895723348998471146533472E464),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.06159425714587587596315273412980326848774E468),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.39842096921552895552865419358618980526522E471),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.10019250200043409620613806802055106588964E475),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.60168637921399337433269021009486348647213E478),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.19223517043016490053318723999451301947514E482),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.99034275177966838169905294250411940918036E485),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.35028180093876978089125889416766330922104E489),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.61932544346605431287309365088850756224928E492),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.59752224396858654822751463995972769669428E496),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.58475372909215510853092900211962048765249E499),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.97344362310464619322979452475954375208857E503),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.04829544198961580704562088031120193024363E506),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.54423670249971909459187315159028026356026E510),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.28155159525861520592744336728994815034465E513),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.42175716315445365776629682852023535157172E517),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.27473363938453836428269762734506894743309E521),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.79852480531101603471120588678046017356641E524),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.82511694842285838878780691728487887003360E528),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.01366744280728845244177798142505561398222E531),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.72300386268598974089881567097839938311418E535),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.06801485391726029063012222285888465884985E539),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.23165095227369784226938168376868111853332E542),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.69365005220259438665890359856477290038803E546),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.84694485580645336061625858231088359767823E549),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.79580913223808226712023217424371555960092E553),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.15301297280898326910671682831131898195108E557),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.80236885426874635751199749203959269714861E560),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.01999525527191083638976173403540390578087E564),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.58020723503261785605925064309501976096755E567),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.68024794226346816440819213491635519854891E571),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.59392445758676533139745740766130689594186E575),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.97026717523264367923353036756994305750078E578),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.07752808742769851870328290789055615430873E582),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.37184676005288788892605541729734210661383E586),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.17362736082955339685176320702550528916649E589),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.80470313049550638446324939404348691666882E593),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.28625090008715012616749095121620718609246E597),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.95439442006361787236681860109203654322012E600),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.78229778527875642617754227085498409140582E604),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.31221467493530774614120768006626238421452E608),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.24629914538355415316797473278393450436995E611),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.00081200767957443088379256557744422648992E615),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.45490487713600784449386174647607953707489E619),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.11855852187380030461278112104407735727785E622),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.51473982089781738947282227683267788799723E626),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.75113706881637740116301126283189082843694E630),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.80349809181880067857531408197895117960190E633),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.46561291170059357226920098161256416101048E637),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.28549456528753068146575779851703354288845E641),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.18014516891773709802568361359859541132919E645),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.14794184919839323266310528457514961692536E648),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.23106915696360359323367942619897466335170E652),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.71304272563543504180689584919760827093455E656),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.16176136327064892053761343577188289805100E659),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.94267596596053911200567908081011776682502E663),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.68968471269738351813126722287238660003127E667),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.47632001422991775961530819344951153465645E671),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.17303774086478150659718412204945351459366E674),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.56346231319052136323518242017878445958006E678),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.56979001523615847570305550188643929870817E682),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.45941021945211998195835573783202237508461E686),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.35830488255698379537240618364248643665317E689),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.82730509148355781859309237766457020835492E693),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.81139431108149316679341415706195013240326E697),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.65102686334067534924556126133956882773870E701),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.77657857933686676416787864645981004789857E704),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.83720796519752188018123652961656078053476E708),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.51393895793803212710538970284637118151994E712),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.13274737136019050759574844453691107878802E716),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.30504736323919264072946656337266531160212E720),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.05082534267833749763629279803999648478041E723),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.00688416122386254366552415568108211268946E727),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.13901606601145217757081201451349136123521E731),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.98382953521271137829146935666600136587268E735),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.26382242764967637125759805248623762869759E739),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.11567865990052291880212168449175462950301E742),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.25299516497207527166736437144905041243536E746),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.42703812566240466005651173862547705813467E750),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.25344601183435273327994630683594072985848E754),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.49340734189703471787696278679883171968332E758),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.97468132265336511875272950939872835444172E761),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.71423014277385086392771011235081637942587E765),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.55466866893172334660033756427494473352982E769),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.11363538602322012783410298038527537953326E773),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.14494541128766620467936349816295405020794E777),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.48898212118138716493239754437855525601551E781),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.04153721885462745535229817358898304874829E785),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.34107388178661367617756282294217568399276E788),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.21352427258719957498011735101632251842789E792),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.73059253177651440928389713921616719798947E796),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.68959287634187707908344949772404950017474E800),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.95364378823194758252988460297223313500189E804),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.42969107308050056334866832130887824627740E808),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.05405917709548863983606307307053682567526E812),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.82891916093869394839933643156535067661273E815),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.85788445718439638255095549802676201475251E819),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.41540158826417247413696934571265942237961E823),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.35257388418128763579649882285810996916073E827),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.56421038571922400015654824093410897444696E831),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.97553439211603760283794140984866307752767E835),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.53306212397594004518094300694800848646553E839),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.19830616048876329173005999481278122690267E843),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.43403426777071169867632136917473572532095E846),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.48061920003850536846848389224680648887864E850),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.97416189843997156412457680145505290763772E854),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.80512566371469977166863099536157263938644E858),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.89233213802803995240381272674459307377637E862),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.17527650577969934073854832881018086957546E866),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.60860868193932239358106918827162612251859E870),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.15814855439273243939286805239499405262811E874),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.79799348330144847770060022198086268603280E878),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.50840757508910859717157606886228646290935E882),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.27427340624245948270893038900870114724408E886),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.08395047535317198674823315790939737019256E890),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.28429263072632843203847035682126539533060E893),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.00701211544951636448041735506344631741432E897),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.95287194842956893388897991583326624147068E901),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.07882892947379762119866679970073989120453E905),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.35090808971096424467133422470805781263325E909),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.74216807250328497396998275843440158908968E913),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.23114923940196769725753466201060575113571E917),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.80068461282782885194274329102689815894695E921),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.43698479631424615836159995590995658398595E925),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.12893071899365835639848270531738180830150E929),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.86752474057722381716466359543791981323863E933),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.64546297493909058096310122044950972594160E937),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.45680082778916978029541901849954314186891E941),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.29669054972579006467352830223129487053165E945),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.16117469769979326571518209176467666645695E949),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.04702322458608725930575400288226912319382E953),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.95160480604248128271273623413280370027672E957),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.87278520666828404211039058315863949514262E961),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.80884716092328225730278892969265426286672E965),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.75842752963460961339932774459525749718768E969),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.72046848801952814708703624675429475764667E973),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.69418027935533264805774085283980483942462E977),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.67901368525118387061646961895146386949598E981),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.67464086143309294626914417397441494566375E985),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.68094360014785832214876780698752741211221E989),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.69800843313480505648937011932340251030490E993),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.72612830441134835418388264826344844863297E997),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.76581083873691810804576401562987501621941E1001),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.81779352688266507112382245589791271829281E1005),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.88306645976580712894489737791466960037418E1009),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.96290358803594053793822299222812423356730E1013),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.05890388192069608603317114204610018578314E1017),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.17304424173578694606467659870339361828116E1021),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.30774659142523621889316065833130311525270E1025),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.46596231224141873152897352659743309725555E1029),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.65127808780250340631674267640330158154878E1033),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.86804839565844042377889660788069208570779E1037),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.12156137309439345372664598939205473163710E1041),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.41824671009102704209993275308412609581985E1045),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.76593671759248292879692067528293003401787E1049),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.17419496716521397347429371836275775387741E1053),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.65473114247175301786710524980513785586157E1057),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.22192631009043451825317845490790007978699E1061),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.89350014566401525440968093028871079403147E1065),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.69136133257633373813072061684170699410103E1069),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.64269518457506352460877569771474118095416E1073),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.78135961744063412895208275943472316581996E1077),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.01496833880086813559469890956773404861787E1082),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.18007910547106149884975247904452059841419E1086),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.38016201672166024130804669264645273244579E1090),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.62368515829137566277544423828234353694770E1094),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.92140488094328935929053190613140004939903E1098),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.28704041953395015285143418830545726696856E1102),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.73816288020603209312306093917376533525463E1106),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.29737130784864316153222745990138672580142E1110),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.99385468996754266229921132308502329760166E1114),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.86547480588573546704404730890231367364285E1118),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.96155473273902730824761873876515267949737E1122),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.34662715175749282144757363976387383344143E1126),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.10549328845990862063671274872739563796461E1130),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.13500786762616486199162139646282197516665E1135),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.42287621406740376920487478613723262741780E1139),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.79391227157392530917313591391466787890833E1143),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.27454291610423118852612012385525951414440E1147),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.90027368880998769412885765503678326199139E1151),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.71902279556312233987487544844774449339792E1155),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.79575342098284515362661102307897336432089E1159),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.21893722018628131010900952922656137977273E1163),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.10961124799958481566839582894070861939414E1167),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.06341231630344021653979721535414115858874E1172),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.40221436367411766246049603213570432898947E1176),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.85922323546455875276684077202605869487232E1180),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.47882820378990363783599212885674227602792E1184),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.32316941619317667365532153676141388576672E1188),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.47964020731247709293854154677691595658026E1192),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.07172167292408573942464448563688951879885E1196),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.27469801512357960785040432675788776226959E1200),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.13385513145977301802405253969778420596624E1205),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.56214622205042434402582434448015324898409E1209),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.16390457072475045959235217347144683175163E1213),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.01370321072266990890128663507360301869632E1217),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.21990324424230880391426953100172070329446E1221),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.94070322057104364218680890469617483399771E1225),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.40814746421602912724325744816977433363083E1229),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.19641999974741190914414431549965447071522E1234),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.71151892274114871038174043669444058705913E1238),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.46143453963085054575745389497735050525112E1242),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.55874853093257400248484181067723236680138E1246),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.17252560628191729765785960880037372952851E1250),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.55785021737632362198478430877447691775300E1254),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.11014107598600420976973529623454970418133E1259),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.63921655673262248140608388592691245128079E1263),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.43313832815256262838551454540004412598313E1267),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.63047664521903302088883716522128641317086E1271),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.44528951863630699294260477558597777941765E1275),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.20980642498907206038159098504227202006707E1279),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.24420984977413469137484839034644273761308E1284),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.89538448869230884837275484491026393187446E1288),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.90227259664776489420336974680616928511290E1292),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.46694417402502662513703273931765086259349E1296),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.91048573950763650431323834770235435491641E1300),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.07455008566878417064485481527214468776891E1305),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.67941925890493880219908491527417575352883E1309),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.63815520764564622084979532107697723076259E1313),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.16528478663265416856309685061018537823321E1317),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.60977427464903137177029019129568577458404E1321),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.05419410057084132957539335929584586086031E1326),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.68982231610419691697070877826572588527457E1330),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.72234095790491268560591489301978343116411E1334),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.40777631396440323367681017885100516372495E1338),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.17243621064190363586486818156912983436103E1342),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.17294744010049595524635668822598673698983E1347),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.92774567407282437795482496134821172800559E1351),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.18401346743565596221431720808799371156331E1355),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.28504512512583234126389723340519680809605E1359),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.81588358281923202720711852158142478310663E1363),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.47781836842450527671177917122479975909890E1368),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.48948257649657015933335755036313460287609E1372),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.21429288134507641967897632921884380820431E1376),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.16906853161545907090964498145129790621985E1380),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.22551313375059455818051689627577444189539E1385),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.10516082738711948060795026028985389663702E1389),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.63378760567296054989330720336340291524854E1393),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.30283080402784951523946330843018599070515E1397),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.09852143386029963348144968536491411546841E1402),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.92385859740160762272314432037027951860022E1406),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.38551282854994205166734858295155457016445E1410),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.98628625083677124814782701178063118397974E1414),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.06357279466818637072892827237483655429956E1419),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.89866668487649279523390717449375757229026E1423),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.40562700284044278923539311172660993053286E1427),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.13772414028445003659106394605581933324392E1431),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.11141102466094150798613215447936426748619E1436),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.02206087622103482189040690021787591594880E1440),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.69624802581714469084053913210353883410771E1444),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.78844843902499830631686067603044269161038E1448),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.25261523304905955403188346882364851165698E1453),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.32219043314126597588895598595082441872888E1457),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.32520010235390984688221773299900173534154E1461),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.09353190301188011869921826936957017881197E1465),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.52155888187832379012098345027094685720855E1470),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.87378031101093380768641582625338090742106E1474),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.45290369727882330417319283925227621167011E1478),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.03945792253750950032063824080954711357541E1483),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.99061011272471512689500879301421450575982E1487),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.82966785317377707695445340176102507156162E1491),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.40162450428301188897123175633335605030985E1495),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.43707512276447791173322049256236599071006E1500),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.80294027503586742806658122896210401922820E1504),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.49193836306761332136433524949539416442977E1508),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.08096196060395346218059340464711593365051E1513),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.13729093189241229865474176889758131900661E1517),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.24503132167380728349826327679130737078829E1521),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.46949952303876398932877322452091266330915E1525),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.69742181279420379386503220619132269926058E1530),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.41721733256393724228534937377400402053897E1534),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.91037859484176378592378082289585127177009E1538),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.40369628243758578555799842969145955764934E1543),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.86406053305533303523234360102119211105314E1547),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.86981829038481135318242328654308653072846E1551),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.20835974532722459348626898880833845690554E1556),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.49857674214045377037391421532552100198990E1560),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.18931140734754631007873986370434608386054E1564),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.08253795484391629425727878998076833696411E1569),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.26823825575142131255980612298093295270564E1573),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.77355740391798336906573156873219869750204E1577),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.00901909733499884192027953526200763974637E1582),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.14218126652323517732723969335927547255705E1586),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.56781490413085596997917832000328661486771E1590),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.78255051620480319539842861122189946934485E1594),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.10418012309708694857630455765139841137259E1599),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.54565895808732386400465289451844270964592E1603),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.86256394460942754260374007847090180313074E1607),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.14910584658222697086656920912281380901936E1612),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.70323556754388815204962841135454250915620E1616),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.03371921260158487835320687947279654584834E1621),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.28176740190384879673274082579331051445564E1625),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.05823607081395022923866625235196627930575E1629),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.12611251965785720564254693755422449277494E1634),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.51776676198767957770677968988065777734277E1638),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.65322519018165338831750318290898321102905E1642),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.27473595546107414222327857650318842949703E1647),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.88657897467946046429886394501667129924188E1651),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.56420330714142618180936313500346758175258E1655),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.49903614447306459330826068178204826230067E1660),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.43771471559990238691710844295458086923620E1664),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.91683095707277723415290703454132514947853E1668),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.83085056742257142066124819709478257528454E1673),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.25177828082741989452751146976209184666034E1677),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.91518250728698981803314662399550710813413E1681),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.32187820863669766378122749723333438522201E1686),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.45987902246166058281136543719088447172639E1690),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.28922204454992272039854347429755420455868E1695),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.05681965834421779945855757865886382628942E1699),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.27789175914272529417292625836445594136452E1703),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.73992829343338510414401202554648967379464E1708),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.17679740882371313613740497261278040690370E1712),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.00678817830782155478193074169805291078004E1717),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.43675456990964439976653811131737948451132E1721),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.92189659902849871577445849311707934015470E1725),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.44504568817156511861910931693331642967080E1730),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.54054776687606923335062157879531965204026E1734),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.71011455202847255405429334420450432597809E1738),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.15148452788046446330389711355308589910104E1743),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.33592819551240570973377164238950280908724E1747),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.32872640833501591003037052308355966001607E1752),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.32209052723291740024709882365143759778563E1756),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.33938732624121809686536217768858237637617E1760),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.10184220378126439536977190688464406239462E1765),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.31870446941552203648291374376708554520937E1769),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.35128800594173068864754005908812799158113E1774),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.44685354685847317110074872013678422869839E1778),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.82728476203078357608995417342485299870004E1782),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.26964222609037331966078221690717541931676E1787),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.85882068366170855342236377741943081675524E1791),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.51838581368432166504538796992068365662454E1796),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.95066132716459592309226003512266889033435E1800),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.03197651634738796995818145605824318377952E1805),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.70631789232510378220709428604910455555156E1809),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.12514042258470117596725253337890695737960E1813),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.88326020311676807556943292520486841847208E1818),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.99719368710874366600099457070072587303486E1822),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.33118272209265452618543379989169383887083E1827),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.55993028907655848453563256675521603555280E1831),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.55728102705697044611754198378566030155756E1835),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.57580500222937252354797291196133531750196E1840),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.96905843127706740684103279791317902598380E1844),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.89284248127927867839067274690226018350597E1849),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.16096421169377774470776061414746078728511E1853),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.41260258819803764324252986061429896813733E1858),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.88131337996238760374969338703717405214633E1862),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.07054217098800900933414847238831984452730E1867),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.96409431241414433080573110199682990843511E1871),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.23835013210689995585612460293428197645347E1875),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.29850417105056075619235210606259863982467E1880),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.43730394464922347809389031653199512122818E1884),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.80972781184312195735371260642829226980541E1889),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.10704755399225793553351862888672803106054E1893),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.44667447899038564248844607573463132750650E1898),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.11351332751144476276671917577051377112191E1902),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.17406751725743144402844839163845193566723E1907),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.36363008640989507136253385412330609782734E1911),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.67286895607183822109686929307056825979180E1915),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.79210174191195536596036978045761263018392E1920),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.08971060455738243016203150276177139056837E1924),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.35265098887713098306176131296267788779609E1929),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.86754907974005155650157510400622299556840E1933),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.01216120163299847570690440553575751633564E1938),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.91748952927958870231725613722939835727095E1942),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.74671866723932954512590224882150276427295E1947),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.17506941605897504099081651583889324943743E1951),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.53891340159465145729530346990408405296308E1956),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.59318574621098465563605129337419515081488E1960),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.37598186845040191929915069082961212404502E1965),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.13720796521752041053050805386375921695822E1969),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.24851856458225771006929432664862636243875E1974),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.78157529111789509341338189791734128695094E1978),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.14957599969140811008585694859544410043527E1983),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.50741309583661222940347053117694716545110E1987),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.07403283841064535280469094968031017641288E1992),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.30085720245656487033846697302476044626286E1996),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.01814957884080351634975884301797949832151E2001),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.15187695023361379253159449071475280062129E2005),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.79257482737614936055853202294403322477975E2009),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.05345614597816164582345471073790450403645E2014),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.55544234610284901429999054259662009403547E2018),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.00103744929812238401700941254152570300172E2023),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.45912011237109626827504905622902377312030E2027),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.99216804215219650245344255646281910405950E2032),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.49892268086904147068185859991528279189945E2036),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.02630771797107530974617976318939375507409E2041),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.67607923880615959456535070812342751015128E2045),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.10477828635279846477236136143401333908815E2050),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.99778680278225274210947592434459805796597E2054),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.23084795272485636694393980424818620377619E2059),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.04776965190049893170160432321360588494507E2064),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.40995810213405348974714042616380221404207E2068),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.11368789464405508615206425845988651852840E2073),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.65011450927116033213645871125221768495551E2077),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.20053638755396948343323913146982514141198E2082),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.96248233771833309949897733718930409948357E2086),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.31244120695706480343710092990597939110559E2091),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.36224672374601377256379974088666428851509E2095),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.45497588189525354842248163708363383953446E2100),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.86983141221469211917289582228508416214683E2104),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.63561841951238325110412591620718896068006E2109),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.51261131414504125783823403898038959653380E2113),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.86439295723134028854761880874907212728933E2118),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.32731761310662154706067009182466554712729E2122),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.15477200150649870326730289799452637205591E2127),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.36342613949028649626793163484347536890301E2131),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.52495064380803191584360489435799890546008E2136),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.68795639028809621591837366658163867515564E2140),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.99965697820002045942822892424261559276849E2145),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.03923132885160922482233503943089864414922E2150),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.61274243761601993635891041000512392479629E2154),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.26021130993273840479071157410502200209323E2159),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.41091637845397110543438583702543380575240E2163),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.54914061792326594872001379267372939471862E2168),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.45917374922678292495910388666432296492562E2172),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.93034330763095209825288403106904354118212E2177),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.84874922921842535380814461858130597804501E2181),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.43811713800136548768144057759005958810171E2186),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.70887365676979435850842327237962758129209E2190),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.12126806833819945889176493238481973971385E2195),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.12243021630753930981616591073314540499861E2200),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.04990077920719937058217768716098563561476E2204),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.46616798314115821926607783613025656591503E2209),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.32567871869377250025029276775107097488669E2213),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.94095584510227205304814038436405844899808E2218),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.09746719836121966992721169810444730918603E2222),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.60396877168098768343642877839738711089618E2227),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.58540328539481294671332004481511744044376E2231),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.54017603054764051064845546827056990844647E2236),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.31182768398402511174435834778399633972971E2241),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.87712422915533385700974783654284329470230E2245),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.81921307576049088259117322231674980995061E2250),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.80822163032926591540517859674895092964158E2254),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.55629996954410905272477280014339685705775E2259),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.62976334767530670486185989923007397911554E2263),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.63950858011928559584404078308295842557531E2268),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.38003749355581630913748118592738773249864E2273),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.24998071216521670913589353808002040958119E2277),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.00373784410905507814597565140736717052948E2282),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.67252228080694439735866856637964654021271E2286),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.94745499363916531879938978192118499104530E2291),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.13596691280170762348938362309295114296345E2296),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.39229371119450162187329921205905365143229E2300),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.70381321016856093760810415597396811240912E2305),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.63063674387406204115838702201585390293835E2309),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.58874263648637969020369824727541140602930E2314),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.01395959406842354662794624248146389397895E2319),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.98426582152804326858623597485476682107820E2323),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.57061451968215704761276967206638788115440E2328),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.21129738133960687706282445974212906447673E2332),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.46424693198547615968667165096278378542553E2337),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.80783374260166221261524051885575719748296E2341),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.91603643457121769131727630603183753909173E2346),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.56856639297583736862472772212031395527427E2351),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.30288588760114267785800803712929894806349E2355),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.54070445530607749548084369182833421001409E2360),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.02741248031823434889962714240895011187454E2365),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.16782361845029711676597803048064831676910E2369),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.69607660273191427727520392612442353037664E2374),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.92390450563330178846148278663422073850378E2378),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.83546306574250639402673359220618545903464E2383),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.16482877227575652622595162092748630763238E2388),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.80024287854501253978154596669332465669940E2392),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.98438175961187724652931912194159767910685E2397),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.22897994254264149851102360026964104662658E2401),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.42313023136710172786273920867337506010097E2406),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.42841816812973305458219189502309452449454E2411),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.97915380163445928223252164716004487776981E2415),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.51058192694840980956234958808776280015963E2420),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.05744378505391541199102941007672202281540E2425),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.46772371354942874967827726441426616283733E2429),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.89347411652853314407973125191300847274773E2434),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.04960196505295494726008189114250946488817E2438),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.43264852750397114900969113394627528136768E2443),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.46832469996369439398996022804225913429369E2448),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.30014650243574379150001080188549387123390E2452),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.71152066714676885668829179885199958083271E2457),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.17059555551390013729734445231826643400600E2462),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.06909541197324624290007450898849353054171E2466),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.20181928480795405509211770603311316889626E2471),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.59308872518938619750312356136832516708451E2475),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.19236238590915562893623081101064961406000E2480),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.83772583694196830986667515810581294676212E2485),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.08020110149197260531380775256529488137417E2489),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.56353607552721570296639254378403953923967E2494),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.57636105132110727518195566515966178117499E2499),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.99429246618017559437266332394176185336432E2503),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.11274435353733670283464790114139242625836E2508),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.38948132837062735875272748569734519461181E2513),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.22113463665521369604174068513122399995262E2517),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.79377961365694757722465492485201060110532E2522),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.25839906298775903535403992468678108160291E2527),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.68520819470413191846188516587056058389482E2531),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.57616785775953734021043475629281645617867E2536),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.17084605233859195325716925121959758176287E2541),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.33729678711618957557120297967274714031274E2545),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.44026447536921945903874884084142294895086E2550),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.11903715152619509393293316170650186517451E2555),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.14685882922097388715457624099360768643524E2559),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.37425979196319369383757678132139174163358E2564),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.09850121526940093495663811864665782379894E2569),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.09750036968361679500537680703688954286946E2573),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.37244697168802064758353588609077901886501E2578),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.10743028201463654624861238137703946375328E2583),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.18459722713105001264313807990338128047084E2587),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.43439204010091039447689383883259931026531E2592),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.14641275333116287266574330809481709594862E2597),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.41457810481698812495063610125021779753917E2601),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.56483539281068533217315675812148991394620E2606),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.21849507051854920806654411173698558617829E2611),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.80571357382180667281501949531951029782443E2615),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.77429819457431943069781978112898512861762E2620),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.32958018650556462745348544401791198042981E2625),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.39054585890231847986394754724374350091648E2629),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.08050254249957103537637770343536152042673E2634),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.48923610423997628231836100829298081453279E2639),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.22041383999189238203860895531712679968429E2643),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.51087491659164064252402121624160718508456E2648),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.71207011858040459983106148505526910052451E2653),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.37295691983238673049007062562278547870329E2657),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.10662914698188368552310225629266905459628E2662),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.01994543853080296471861973233077649573962E2667),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.96413327739224211193972049435493898296953E2671),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.92927864297144785466980154722633504141016E2676),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.44550965716981091946398261539507470412973E2681),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.21673442126567729912701688383922322688369E2686),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.07100843767772018624156225115149071358429E2690),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.03782494988299289656457044125279209702715E2695),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.52440287861263056550156931088335649022469E2700),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.67132053078199935920009773995131623419251E2704),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.87143616770673437647872895471691520439866E2709),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.95931353043220215858793239906868225233491E2714),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.94406361840063082132095382142730702429660E2718),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.06116199820246334681898222847619987378059E2723),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.58321909083113270532895824574071518544846E2728),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.32219399136729353268418952717454350183645E2733),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.78656998273248329087321341746545837670603E2737),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.49321233480477654339506701841454781106178E2742),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.80309009997826192850849541275040464093255E2747),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.33310084393021656789450800715864492676702E2751),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.84449903140598260444914651117949649204532E2756),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.52164809095997124081233057493600690683028E2761),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.31622787093270847483817333338537725028557E2766),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.88948882683273867426105652113079591049368E2770),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.61618424286438450925998429350153362393221E2775),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.90335612475811913711654328360362702877949E2780),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.00460154458464065708184720064399606958292E2785),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.31704388559784222560358558840481755959628E2789),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.82193886675248886868275143890190048549965E2794),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.50184202300344959033799790094592416174073E2799),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.01490804813721664934874030063317271052437E2803),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.28912623512161990713803612919255893744453E2808),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.30161913723146134487082070032091311844374E2813),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.23848513685005321500696264511185470520993E2818),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.68250373114900794305924451807404428048979E2822),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.61557239393801293203023416957497885965478E2827),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.96156510862742962910470314628298207562258E2832),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.06712325969292456443588109638283726404570E2837),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.82117987018203524640139732705717072641838E2841),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.18412722947632272773220801727926821135623E2846),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.74642990218301959797343625730084399882464E2851),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.60487356529976633387688284281349868505376E2855),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.29675997872470269213496075230818689035562E2860),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.92890635333865219897753657617028711239068E2865),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.62396116257770476994582180473788474279223E2870),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.02857404700273623561323835503248429901719E2874),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.03308748635790582895050344130806889261028E2879),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.81332565006226747903137185243419463521020E2884),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.57679113229632084013826375333905634536190E2889),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.86125834394592566727216453150426569328939E2893),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.99323640432151102944021268654706824400220E2898),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.82119299395090128771708224360873021747117E2903),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.59825416967437949338573019944542796675186E2908),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.07861759034693236394709580405760897935910E2912),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.17074211445647214215434756609206844339325E2917),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.95286618510252884751609588041667597208599E2922),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.69079457862610355269009414031781341324444E2927),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.70716879966951604823854226008517513384716E2931),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.58788473230671549379527193117588360570656E2936),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.22517948915495742349290595788774411653035E2941),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.86642441966918817869780257649043160430008E2946),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.08296762685461822265710935405697307204405E2951),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.30039200716986286528270627727201807729056E2955),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.67506637724542868511876348598651751065777E2960),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.14934837108513207310751625333984905318218E2965),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.26034935181261939500060043463090447432409E2970),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.40996362377123130298090697193525499360978E2974),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.36798075846786268664323170086115588968407E2979),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.58156682335078967125082945760355554410013E2984),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.52975735756834262991256082724328206222725E2989),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.08859539426336455462506156761737517671857E2993),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.41382916925458564836359460423103041535434E2998),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.23328811960609275944700582796921628157288E3003),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.93604243773487580318391576585403842465799E3008),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.16228993420229171574772931879739822166736E3013),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.99587035050056707155061425128761569750802E3017),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.22177649649010641739294523304806828850342E3022),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.55430923986891257038234387771899174612190E3027),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.54944087155011980122514355808741056241787E3032),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.42319952595478495553395998127899247505096E3036),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.74568966077238766886118391317005055211896E3041),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.51240752100724079856504532837647160325259E3046),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.15270811379751736461491456989001087614325E3051),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.32276128973373944034023716865977015465442E3056),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.14877738850648875359113694854224858409783E3060),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.03288085847932606974172900427078426461190E3065),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.11639601010305812626973527481834578036014E3070),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.93463483114821435351479678248070302143513E3075),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.20407716624311665193848924092464181027639E3080),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.51306558344496470479570706050116162186773E3084),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.69987351256316491449315052050083853541496E3089),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.94754119734976241171387293452381386670284E3094),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.85326241628642007776388610067364614188536E3099),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.16819642791210054557526449399759104080004E3104),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.38236228587334534850527654640401584287502E3108),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.67707104105809642984779796295492748773037E3113),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.97064203408436243144218324894482450647631E3118),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.89157268828256447627492010391225975548210E3123),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.20750996344019371381041855406153211332624E3128),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.72773120824010179184551559965944155778086E3132),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.95798848804849566946680471201217989153231E3137),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.18896586244623625992504795671556682286380E3142),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.05628689582137010650767023925678241133727E3147),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.32924691877171409347950931334388628741405E3152),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.61418851957783565376563379778763365925260E3156),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.59639653362187417590993361534314564216051E3161),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.64490848346938843745793888345437686418000E3166),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.37983840902686046999056966563280009598826E3171),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.55772092526766986536215215502206916677163E3176),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.02214342027002972168255108491773037373875E3181),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.72376735889157084211665199881425209579249E3185),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.43395049157030817990544696372378022974715E3190),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.93119685466891744855315002353222350937275E3195),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.94255706875266454954994592139210017235492E3200),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.29055320297862278689126555810623506869470E3205),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.59508232973211830376877588355778919513603E3209),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.73845326522297004986728006171967065845730E3214),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.84068791510068985673692691533115733168405E3219),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.57686244195552355114988662590005930750623E3224),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.73316610732037731038876504765998784420786E3229),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.16856955245017855941284368305261087056934E3234),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.89828983669498077780943330620945985187115E3238),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.35148590916421669440053549392438797901834E3243),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.63477243935039517793195292564440973577695E3248),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.47480104800297514504656930323357633969507E3253),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.68912693925479085006387894244856975938991E3258),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.15569152450072277405799796535540796252474E3263),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.92643540454236140571828867039157567632336E3267),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.44965481418304879652471862017890685484597E3272),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.75589858990025479589481294227571183513780E3277),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.59484390268214385462251432964921121180818E3282),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.79704875239778996934791532833836026453566E3287),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.24755141507443871271381516610796950445589E3292),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.68171952151444814391021588638851031874634E3296),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.05620389821312092201615944422795857227643E3301),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.23488287633181409902978199561714357364141E3306),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.96843291164333886629592974804974993290581E3311),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.08572350893048481645474061026079094886422E3316),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.46902316987943202636162351330156673513841E3321),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.03715034650505289230207763788352269657228E3326),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.33997706783665676914483836506939616801366E3330),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.20698541216823413059600455295633783913955E3335),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.70267377331923958364102910840350982514052E3340),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.63925122799576031507622520616835408969214E3345),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.88573635307269858159515085667491420338326E3350),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.35056329233826178428855968767830245899588E3355),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.69574998099830152611304689898599180200012E3359),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.97716746262839820215172131916998930451956E3364),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.03276828039975394292562456048335229926269E3369),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.63884496365180016808062351190070503669829E3374),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.63722863126925160616961377539902289011753E3379),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.91583635165376710872046484769676789859712E3384),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.39506429361500731932826786580356767075965E3389),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.01824905261494319064446555648693321130651E3394),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.44966216260685755086792263165893032080537E3398),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.46311963220808524159410778160156771399100E3403),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.01573654167698914420193589049783696387487E3408),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.95875419018386666090150305950957979089993E3413),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.18509607405428839931273317906409849251058E3418),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.61751744455702025086491965530118918610296E3423),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.20017066201551174674893567594001025055453E3428),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.92588834989902944901579168442872495241088E3432),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.65385176369188551766993827561899114596172E3437),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.97172203109845789597334807647407115591785E3442),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.72350058257798496744202033784870278682868E3447),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.79515378354172137336497603439137571011010E3452),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.10314157721272069816911881988380118687331E3457),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.58612957532095926795914807346600408424123E3462),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.19898845727964873071164668215624297313692E3467),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.08440236815702565843030025224652660219668E3471),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.89892749443596516381735429602310891371395E3476),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.25133228614936158788504689126632587237494E3481),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.00644295095673993388450280847060358185001E3486),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.06371820282027028228065995079497899460414E3491),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.34821528413097378373214582383480739591987E3496),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.80395249014808731733001109667101978134036E3501),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.38902232680343734576091106893375470768849E3506),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.07198611581832952598609944149320086638918E3511),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.29208522465094071970569948542385636390768E3515),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.42882906445293964054147519865556089034400E3520),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.99565444030279744536805664303230768631426E3525),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.89084704258229918884927383868103433940556E3530),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.03728855575148468153744283392927569735051E3535),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.37638580369569469533860169653434887519134E3540),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.86352713025186190069288600870480484907575E3545),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.46467491349803626927079371510470637818232E3550),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.15380495457903357865995484669823308319695E3555),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.10978383534893509226426829619954178096433E3559),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.20886919398300180430545110482715372932576E3564),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.71753073427761194916291733781074991926465E3569),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.54497030263400732698009477133055066160483E3574),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.62104285082528303213422890167863635335532E3579),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.89144706794977849283149065498004371547141E3584),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.31406041939771065743582146170704328316738E3589),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.85614075992356323527322098162359530443356E3594),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.49218541298147659627327933831420417158701E3599),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.20229003262717536581012625099185359480052E3604),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.70888115457977019665826504262523942105297E3608),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.85780985074702970568007230404944849325153E3613),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.37389859829851340022881911319772873543849E3618),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.18178040647211744904890798964720228666642E3623),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.22203662195304404051894275063818317122092E3628),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.44772838642913017502581355084557561304658E3633),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.82170152171785634622415958685261271079965E3638),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.31448837671199852645504394450542490692011E3643),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.90267129803318076528621322739306071109626E3648),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.56760373682131248814028954900839184743976E3653),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.29440894531653894655178531238550994536683E3658),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.07119453308161583096009170226292300941993E3663),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.88435190810858155115125256646660612639704E3667),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.38486668282810366917023626758965332453075E3672),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.15202383800815571818087673521771835556317E3677),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.13630431043170550623657387651021935797461E3682),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.29773680812429643472319339787622075937767E3687),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.60399488774588476251017219498217248348011E3692),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.02888474560503155239916774600736129734193E3697),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.55114130220518736555298263579412185513797E3702),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.15346798286953554929917331753619305160793E3707),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.82176947634360209405946649731160082729634E3712),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.54453758058234789298017795698410121100621E3717),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.31235870594593725724703075451729353753881E3722),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.11751822929778138888497999540235561723515E3727),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.53682086077944179302162438167708666109669E3731),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.15640066883196802693154706550746653054637E3736),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.99098494872818414271857539605226069118123E3741),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.00512490112681807163822414454110272756350E3746),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.16950024188094771673268208932842799510902E3751),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.45981547823531002624013456732574984418236E3756),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.85590225336168418708128321889033696242657E3761),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.34098802417699522351564081593703704054598E3766),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.90109922668021573673509437607880037682892E3771),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.52457336344433445944808956391256784292693E3776),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.20165945571634855552452921329534121249204E3781),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.92419030219093644807836475584459137435316E3786),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.68531318609977022384331951443249589851739E3791),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.47926823596673047574998574104876668980816E3796),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.30120570289388380311753092163501378057458E3801),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.14703507115345045340538426924274390742584E3806),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.01330025045636684915049677695168611229782E3811),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.97076172060559176230095800755753386534637E3815),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.95882978148894308449678324892221739283773E3820),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.07614695468502479572019394302790202864210E3825),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.30479852626040919966029051645154696615913E3830),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.62951961666418810705658393972298450986663E3835),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.03728159409905409276795948084334492929220E3840),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.51694609131683484358191926879468312334941E3845),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.05897511892583420262035838677209235995098E3850),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.65518779897897890901460368203947065354873E3855),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.29855590304154667106010178551381217532214E3860),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.98303173866272791201688239951587911961970E3865),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.70340304331773297951634193145131786689784E3870),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.45517046080009624179387244376854633544448E3875),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.23444392843249053841760550244837685628955E3880),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.03785492407800328053785698056078232572999E3885),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.86248203391877573484077976574309945813736E3890),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.70578772495199996009562991241621096967851E3895),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.56556455611055099189124740475889597037631E3900),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.43988935186983293948861878563217446478880E3905),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.32708410278425740621869390179304599051996E3910),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.22568255729602707502702153496002614570602E3915),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.13440163548899414855578730165456121198151E3920),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.05211693405235680292050999970530716598537E3925),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.77841707359308221908236120654234279358374E3929),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.10708806188856270483701902834952230372496E3934),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.49955136463310213847124615598005693612936E3939),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.94908268108565804461089015205653316740675E3944),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.44974880972279771873639714051139601169122E3949),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.99630782476934014460814179998158928837794E3954),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.58412271847295400613100306035962170624341E3959),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.20908659583348770719249208717684323340658E3964),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.86755779386316539182148990912572098233934E3969),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.55630353847526037391747840562641660429686E3974),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.27245095593624944224263414261383421277805E3979),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.01344442843378981822879212611722303064057E3984),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.77700842968455242380073620048853203303419E3989),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.56111510078634178787670528329101878113668E3994),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.36395593218199270166771944909712684043874E3999),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.18391700755700058630594549525859114761488E4004),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.01955734217735301069292328676089558409618E4009),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.86958991363574575878627523129665291757985E4014),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.73286503893407018186101714056317500087209E4019),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.60835579973610739080016277873733957684262E4024),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.49514525869747456534726108397519377654128E4029),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.39241524505032656374772961387252436274078E4034),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.29943651795894880142662948178241363071400E4039),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.21556014230635550859811943037855164285717E4044),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.14020993414637781555605879955772746129785E4049),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.07287585259140675269276174464956313127175E4054),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.01310823185479918772401854825592255099054E4059),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.96051276191437626818506412960054930888210E4064),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.91474613913903659612300647663377038390127E4069),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.87551231950697498510314983492166544553236E4074),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.84255931698470456938003609353757606810418E4079),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.81567649844143614870148390411587985670403E4084),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.79469233432626827505853914765633446553416E4089),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.77947257139610678596300402081449334082853E4094),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.76991880019140632162525162126002463568042E4099),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.76596739584043301328893587983739009932917E4104),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.76758881624411988030016138807383662387765E4109),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.77478724685634765115227807646604313622962E4114),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.78760058622495795062260113562018983794797E4119),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.80610077128822516933904835810605281727979E4124),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.83039444621808057345639416771173978643093E4129),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.86062398345224471203909414364284371702937E4134),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.89696887055061172352573890703458810429981E4139),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.93964748173760630604433591807861796307774E4144),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.98891925854751852607638018181216139880831E4149),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.04508732997672102395245038383788302943129E4154),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.10850160907719746474895815062586752340780E4159),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.17956241012382087578705283397501096596325E4164),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.25872463849188010495391371976793913817040E4169),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.34650261434796486911507388147425876654572E4174),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.44347560136463141315899157242308659981638E4179),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.55029412312135074730088684090791818212895E4184),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.66768716288605341971598509186339851714547E4189),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.79647035735479442004427800029786408560737E4194),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.93755531197684688245593057402179562697057E4199),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.09196018507559584254763845093071046732403E4204),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.26082171051962095913872012950677003646015E4209),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.44540885470315644057680807036093474083672E4214),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.64713833364590806859990065054841867206527E4219),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.86759225080528892219080990652576657420497E4224),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.10853815651555125947557329690066066619163E4229),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.37195187677603515727601363111331485250805E4234),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.66004351352122024390004344845623487393963E4239),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.97528708183480861814094584081783471033006E4244),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.32045432337268403411881656537520605374587E4249),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.69865332137199232487655966593899602364607E4254),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-7.11337264321912880742434049523560647396684E4259),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.56853185420275088133874643207881721405157E4264),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.06853938384255369307667238450912668146356E4269),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.61835888768593532418859630416825939431142E4274),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.22358543701229167366031925673039817188714E4279),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.89053309160674703146471853360057212309125E4284),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.06263356727710701512854538457027426843791E4290),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.14390628623159119127127441351127598128829E4295),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.23378541171256590449934074408987091684192E4300),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.33330733184053021905017091601527612586991E4305),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.44364875823540328629606562921959876952917E4310),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.56614742596747185173656286731874851008760E4315),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.70232608629084278063412018432408101728629E4320),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.85392035045578635040914841896608734406300E4325),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.02291104311559859219790751241063261573974E4330),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.21156184299279225305571674393824046661267E4335),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.42246313029401131817808024730540747609622E4340),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.65858312938177279103043664051984762778903E4345),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.92332763688198894108136508552074221654033E4350),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.22060986632955715910426753105801968327132E4355),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.55493222862133012815214902606640024154640E4360),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.93148221264316732379836632739005868449884E4365),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.35624494422139957865023547858329738911290E4370),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.83613549830312116597133162588849016813809E4375),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.37915463637146135975068266263906260629699E4380),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.99457235971686130967859680435034669250144E4385),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.69314453512429006079393609539716193404520E4390),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.48736889431350979708439568951700859706102E4395),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.39178797060980781053157816156403733979319E4400),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.42334806297892120347511031200309682003534E4405),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.06018251665164840590301773402250488431888E4411),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.19503310506395297988508675434270665165587E4416),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.34959153886867399216779892358692575842948E4421),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.52702831525329111390530709265753913247966E4426),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.73106505151092064040944225522401523497426E4431),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.96607674151009284007626463593558521619991E4436),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.23721409324575068119136123883110590620178E4441),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.55055009490389144571972918721525332423167E4446),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.91325585331366730370765190627765816412899E4451),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.33381184707239476428581714085009232416866E4456),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.82226208428804491349011885849256341039180E4461),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.39052031053386419818620236802663043012012E4466),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.05273944933505208009211497620661087146648E4471),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.82575796635087004311789949295452145879942E4476),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.72963994293820358200884688457588132053169E4481),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.78832946681639601549330635711631247196971E4486),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.03044467446902507304741752876213402540916E4491),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.04902426338199362916765823614200052475247E4497),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.22087935150896491225508166407225157327669E4502),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.42354115122010951274965599105011043847140E4507),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.66294011861854161696470804435696742936153E4512),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.94621918590048211613785506477563525036572E4517),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.28199500884200690963176401178191132249330E4522),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.68067819821310854364832425425811121603998E4527),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.15486642747278408638960959920775910349995E4532),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.71982771016080179753042020620157026971999E4537),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.39409540436027791914002758007154998021816E4542),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.20020185477961560874169033983030614844219E4547),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.16558431294360865237779141560327725151636E4552),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.32370524853138298143375110415885263644472E4557),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.71543984612409064716393083476036181782037E4562),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.03907969660921565101173608760330476684966E4568),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.24110568955698242561960824747347885780009E4573),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.48514307969638033952165855026228077254601E4578),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.78043741216497363734082116815430009480240E4583),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.13837209915751888208820943517177022274539E4588),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.57298507114906955103427657090936075958758E4593),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.10161537961764373476299755901109720335442E4598),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.74571365761636822990615194677004270335695E4603),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.53185949616194071983515003308256170067697E4608),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.49304049532692799832153833658423356646503E4613),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.67026273060300930659501812225273074179786E4618),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.11458158479349490377525521327398244068778E4623),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+9.88966656181088304415905473037110272587104E4628),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.20750454165392973471627593257009762333003E4634),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.47702137788584368823389947135495930878248E4639),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.80998491214790876758304352407064582117941E4644),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.22204359432522898091636026552778030009296E4649),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.73286970124633836169951526822404995141111E4654),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.36723394542192246355351827264239717714502E4659),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.15637722504127360243127248931402015039188E4664),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.13976436809289046623516243179535059115134E4669),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.36732969376086547687958922800221601137039E4674),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.90235674293410600736251437871702640783856E4679),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.82517696631443171289797659548307030140621E4684),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.22379276017859328243572483713594686708794E4690),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.52706815145275040485314081520747755519198E4695),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.90893568257226882949610158040126359790463E4700),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.39059388861696624878037894133184747369855E4705),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.99917110657689383364452100289448985632111E4710),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.76944065545373667002479844478435643757787E4715),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.74604776985189143857600204752925810735136E4720),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.98640546924144772076657616454676753335927E4725),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+7.56446615553687205171251911999971153461583E4730),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.57564140804791872004035674579697648895121E4735),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.21432295183503545169961971380339549742284E4741),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.54268259197986435301209379430192419623405E4746),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.96333453979319218327098398656755635860269E4751),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.50314896901390118257211812139803462258411E4756),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.19707671125010296452656766472908984716173E4761),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.09065355202582248857829352617457293485768E4766),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+5.24330276965152053675952126461515990669880E4771),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-6.73269717090377530926128812704408867418207E4776),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+8.66052954380177051693058921002012814254316E4781),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.11601582361114963459287011273051945411275E4787),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.44067530643292012921803692792303069551963E4792),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.86307803485325622741539779802696993888104E4797),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.41359541345881044240965631401911504169944E4802),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-3.13231702959725859967859001277971794514368E4807),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+4.07224676337158431253447410275613761971613E4812),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-5.30357751152182715714630536918195046756875E4817),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.91941751868863603233513125358433164549144E4822),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-9.04347331293424115373208761248456939897939E4827),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.18403740026504421382604459063992423735940E4833),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.55295668541580089440974399336733409977695E4838),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.04040489305295222158169480712647320462460E4843),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.68556576384158021903340233121920677620987E4848),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.54092705736192905032781187529002524811985E4853),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.67691260753888541940765676276799116357384E4858),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.18816590356676064756932370462343333022874E4863),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.20208747189502996469904263725541180637292E4868),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.08904527435538965461419665176131097057955E4874),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.44852468497655386911944704230020622614822E4879),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.93002810037678483950238728095642458197403E4884),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.57607479909602358946212831252466498068242E4889),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+3.44436963501199034729713492845297240203831E4894),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-4.61335444129925369411360915476997868499253E4899),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+6.18983430686687901855534950725753784092209E4904),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-8.31947076066515753458059357125827636823325E4909),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+1.12012424007099676198610268058738481324473E4915),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-1.51074045139974682835109010863898039812430E4920),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(+2.04110823109132319887750995937125750381897E4925),
+    BOOST_MATH_BERNOULLI_BIG_ENTRY(-2.76244775144701247273330293657587383853873E4930)
+  };
+
+  #undef BOOST_MATH_BERNOULLI_BIG_ENTRY
+
+  // Types with a wider significand than the builtin long double parse the
+  // text of each entry, once.
+  template <class T>
+  struct bernoulli_big_table
+  {
+    bernoulli_big_table()
+    {
+      for(size_t i = 0U; i < m_data.size(); ++i)
+      {
+        m_data[i] = boost::lexical_cast<T>(bernoulli_big_data<>::entries[i].text);
+      }
+    }
+
+    boost::array<T, 1157U> m_data;
+  };
+
+  // Rounds one entry of bernoulli_rational_data to T. Only the leading
+  // digits of the numerator can affect the result, so when T has a fixed
+  // precision the rest are replaced by an exponent rather than parsed.
+  template <class T>
+  T bernoulli_rational_value(const bernoulli_rational_entry& entry)
+  {
+    const std::string numerator(entry.numerator);
+
+    const std::size_t sign_size   = ((numerator[0U] == '-') ? 1U : 0U);
+    const std::size_t digit_count = numerator.size() - sign_size;
+    const std::size_t guard_count = static_cast<std::size_t>(std::numeric_limits<T>::digits10) + 10U;
+
+    const T num = (((std::numeric_limits<T>::digits10 > 0) && (digit_count > guard_count))
+                    ? boost::lexical_cast<T>(  numerator.substr(0U, sign_size + guard_count)
+                                             + "e"
+                                             + boost::lexical_cast<std::string>(digit_count - guard_count))
+                    : boost::lexical_cast<T>(numerator));
+
+    return num / boost::lexical_cast<T>(entry.denominator);
+  }
+
+  // Each entry is rounded to T once, on first use, so that warming up a
+  // multiprecision cache costs a string conversion and a division per entry.
+  template <class T>
+  struct bernoulli_rational_table
+  {
+    bernoulli_rational_table()
+    {
+      for(size_t i = 0U; i < m_data.size(); ++i)
+      {
+        m_data[i] = bernoulli_rational_value<T>(bernoulli_rational_data<>::entries[i]);
+      }
+    }
+
+    boost::array<T, 310U> m_data;
+  };
+
+  template <class T>
+  BOOST_CXX14_CONSTEXPR T unchecked_bernoulli_imp(size_t n, const mpl::int_<3>& )
+  {
+    return T(bernoulli_int64_data<>::numerators[n]) / bernoulli_int64_data<>::denominators[n];
+  }
+
+  template <class T>
+  BOOST_CXX14_CONSTEXPR T unchecked_bernoulli_imp(size_t n, const mpl::int_<1>& )
+  {
+    return static_cast<T>(bernoulli_float_data<>::values[n]);
+  }
+
+  template <class T>
+  BOOST_CXX14_CONSTEXPR T unchecked_bernoulli_imp(size_t n, const mpl::int_<2>& )
+  {
+    return static_cast<T>(bernoulli_long_double_data<>::values[n]);
+  }
+
+  template <class T>
+  BOOST_CXX14_CONSTEXPR T unchecked_bernoulli_big_imp(size_t n, const mpl::true_&)
+  {
+    return static_cast<T>(bernoulli_big_data<>::entries[n].value);
+  }
+
+  template <class T>
+  inline T unchecked_bernoulli_big_imp(size_t n, const mpl::false_&)
+  {
+    static const bernoulli_big_table<T> table;
+
+    return table.m_data[n];
+  }
+
+  template <class T>
+  BOOST_CXX14_CONSTEXPR T unchecked_bernoulli_imp(size_t n, const mpl::int_<4>& )
+  {
+    typedef mpl::bool_<   boost::is_same<T, tools::largest_float>::value
+                       || (   boost::is_floating_point<T>::value
+                           && (std::numeric_limits<T>::digits <= std::numeric_limits<long double>::digits))> tag_type;
+
+    return unchecked_bernoulli_big_imp<T>(n, tag_type());
+  }
+
+  template <class T>
+  inline T unchecked_bernoulli_imp(size_t n, const mpl::int_<5>& )
+  {
+    static const bernoulli_rational_table<T> table;
+
+    return table.m_data[n];
+  }
+
+  template<class T>
+  BOOST_CXX14_CONSTEXPR T unchecked_bernoulli_b2n(size_t n)
+  {
+    typedef mpl::int_<bernoulli_imp_variant<T>::value> tag_type;
 
     return unchecked_bernoulli_imp<T>(n, tag_type());
   }
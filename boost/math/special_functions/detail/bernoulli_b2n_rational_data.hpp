@@ -0,0 +1,2330 @@
+///////////////////////////////////////////////////////////////////////////////
+//  The Bernoulli numbers B0 ... B618 as exact fractions, generated from the
+//  tangent numbers in exact integer arithmetic, for bernoulli_b2n.hpp.
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef _BOOST_BERNOULLI_B2N_RATIONAL_DATA_HPP_
+ #define _BOOST_BERNOULLI_B2N_RATIONAL_DATA_HPP_
+
+  #include <boost/config.hpp>
+
+namespace boost { namespace math { namespace detail {
+
+  struct bernoulli_rational_entry
+  {
+    const char* numerator;
+    const char* denominator;
+  };
+
+  // B2n = numerator / denominator in lowest terms for n = 0 ... 309, that is
+  // up to B618, the last coefficient used by the Stirling series in tgamma
+  // at 1000 decimal digits. The values were generated from the tangent
+  // numbers, B2n = (-1)^(n+1) 2n T(n) / (4^n (4^n - 1)), in exact integer
+  // arithmetic. |B618| is about 10^965.
+  template <class Dummy = void>
+  struct bernoulli_rational_data
+  {
+    static const bernoulli_rational_entry entries[310U];
+  };
+
+  template <class Dummy>
+  BOOST_CONSTEXPR_OR_CONST bernoulli_rational_entry bernoulli_rational_data<Dummy>::entries[310U] =
+  {
+    { "1", "1" },
+    { "1", "6" },
+    { "-1", "30" },
+    { "1", "42" },
+    { "-1", "30" },
+    { "5", "66" },
+    { "-691", "2730" },
+    { "7", "6" },
+    { "-3617", "510" },
+    { "43867", "798" },
+    { "-174611", "330" },
+    { "854513", "138" },
+    { "-236364091", "2730" },
+    { "8553103", "6" },
+    { "-23749461029", "870" },
+    { "8615841276005", "14322" },
+    { "-7709321041217", "510" },
+    { "2577687858367", "6" },
+    { "-26315271553053477373", "1919190" },
+    { "2929993913841559", "6" },
+    { "-261082718496449122051", "13530" },
+    { "1520097643918070802691", "1806" },
+    { "-27833269579301024235023", "690" },
+    { "596451111593912163277961", "282" },
+    { "-5609403368997817686249127547", "46410" },
+    { "495057205241079648212477525", "66" },
+    { "-801165718135489957347924991853", "1590" },
+    { "29149963634884862421418123812691", "798" },
+    { "-2479392929313226753685415739663229", "870" },
+    { "84483613348880041862046775994036021", "354" },
+    { "-1215233140483755572040304994079820246041491", "56786730" },
+    { "12300585434086858541953039857403386151", "6" },
+    { "-106783830147866529886385444979142647942017", "510" },
+    { "1472600022126335654051619428551932342241899101", "64722" },
+    { "-78773130858718728141909149208474606244347001", "30" },
+    { "1505381347333367003803076567377857208511438160235", "4686" },
+    { "-5827954961669944110438277244641067365282488301844260429", "140100870" },
+    { "34152417289221168014330073731472635186688307783087", "6" },
+    { "-24655088825935372707687196040585199904365267828865801", "30" },
+    { "414846365575400828295179035549542073492199375372400483487", "3318" },
+    { "-4603784299479457646935574969019046849794257872751288919656867", "230010" },
+    { "1677014149185145836823154509786269900207736027570253414881613", "498" },
+    { "-2024576195935290360231131160111731009989917391198090877281083932477", "3404310" },
+    { "660714619417678653573847847426261496277830686653388931761996983", "6" },
+    { "-1311426488674017507995511424019311843345750275572028644296919890574047", "61410" },
+    { "1179057279021082799884123351249215083775254949669647116231545215727922535", "272118" },
+    { "-1295585948207537527989427828538576749659341483719435143023316326829946247", "1410" },
+    { "1220813806579744469607301679413201203958508415202696621436215105284649447", "6" },
+    { "-211600449597266513097597728109824233673043954389060234150638733420050668349987259", "4501770" },
+    { "67908260672905495624051117546403605607342195728504487509073961249992947058239", "6" },
+    { "-94598037819122125295227433069493721872702841533066936133385696204311395415197247711", "33330" },
+    { "3204019410860907078243020782116241775491817197152717450679002501086861530836678158791", "4326" },
+    { "-319533631363830011287103352796174274671189606078272738327103470162849568365549721224053", "1590" },
+    { "36373903172617414408151820151593427169231298640581690038930816378281879873386202346572901", "642" },
+    {
+      "-34693422478478287895520886593238525413997667857604911468700058913715012663197248975923065973380"
+      "57",
+      "209191710"
+    },
+    { "7645992940484742892248134246724347500528752413412307906683593870759797606269585779977930217515", "1518" },
+    {
+      "-26508796021550997133525972146851620144431514991925098964517884276809667565148755153667812035526"
+      "00109",
+      "1671270"
+    },
+    {
+      "217378323193691633333107610866529914757211566790908313608061101149336054842345936509041886185626"
+      "49",
+      "42"
+    },
+    {
+      "-30955391657184297691251345803384141686900412806432984424550404572100895752457196827138819959575"
+      "4752259",
+      "1770"
+    },
+    {
+      "366963119969713111534947151585585006684606361080699204301059440676414485045806461889371776354517"
+      "095799",
+      "6"
+    },
+    {
+      "-51507486535079109061843996857849983274095170353262675213092869167199297474922985358811329367077"
+      "682677803282070131",
+      "2328255930"
+    },
+    {
+      "496336660792625819125326374759907574387227903110601397703093117931506832141004313290331136780980"
+      "37968564431",
+      "6"
+    },
+    {
+      "-95876775334247128750774903107542444620578830013297336819553512729358593354435944413631943610268"
+      "472689094609001",
+      "30"
+    },
+    {
+      "555633028194927485061632440891895138052556730712674724679678230433359428640050898128724141993452"
+      "9638692081513802696639",
+      "4357878"
+    },
+    {
+      "-26775470774254808288695440558528239477929145959255174062997868606335779273486353014536266309351"
+      "9862048495908453718017",
+      "510"
+    },
+    {
+      "192821517513613091564529952227159643530761101016472845878373302052854862240350407859517441169389"
+      "3882739334735142562418015",
+      "8646"
+    },
+    {
+      "-41095194584699337820902048652357193812325807787047750243346974796265007075470486381264639280186"
+      "3686694106805747335370312946831",
+      "4206930"
+    },
+    {
+      "264590171870717725633635737248879015151254525593168688411918554840667765591690540727987316391252"
+      "434348664694639349484190167",
+      "6"
+    },
+    {
+      "-84290226343367405131287578060366193649336612397547435767189206912230442242628212786558235455817"
+      "749737691517685781164837036649737",
+      "4110"
+    },
+    {
+      "269486654899088093604385168372411304084907849466428248386215089306047850155954624342363337569332"
+      "5757795709438325907154973590288136429",
+      "274386"
+    },
+    {
+      "-32894909864358988039306995488518840068805374769311309813074670851625048029736180966938595981252"
+      "74741604181467826651144393874696601946049",
+      "679470"
+    },
+    {
+      "147318532808885895658700804424532142398042170239906426761948789974075460615816431065699661892117"
+      "48270209483494554402556608073385149191",
+      "6"
+    },
+    {
+      "-30502446983736075650351558369017263574050071042565667618841918524348510337447612763926956693296"
+      "26855965183503295793517411526056244431024612640493",
+      "2381714790"
+    },
+    {
+      "412057002628011487152611331590786402616554560880854115397381768003479026268352428485581000862190"
+      "5238290240143481403022987037271683989824863",
+      "6"
+    },
+    {
+      "-16917371456140189798655610951121661896076828521473014008164806759169578711786484332848214936063"
+      "61235973346584667336181793937950344828557898347149",
+      "4470"
+    },
+    {
+      "463365579389162741443284425811806264982233725425295799852299807325379315501572305760030594769688"
+      "296308375193913787703707693010224101613904227979066275",
+      "2162622"
+    },
+    {
+      "-37370181411551085021058928884912821658374895314889329517685071271824097313284720844566536398125"
+      "30140212355374618917309552824925858430886313795805601",
+      "30"
+    },
+    {
+      "102597186820380210510277942383791844610257386524605692339927764897508813375068638084486850543226"
+      "27708245455888249006715516690124228801409697850408284121",
+      "138"
+    },
+    {
+      "-81718086083262628510756459753673452313595710396116467582152090596092548699138346942995509488284"
+      "650803976836337164670494733866559829768848363506624334818961419869",
+      "1794590070"
+    },
+    {
+      "171672676901153210072183083506103395137513922274029564150500135265308148197358551999205867870374"
+      "013289728260984269623579880772408522396975250682773558018919",
+      "6"
+    },
+    {
+      "-42408607942033103760655634923611569499893980870863732147106257784584419404778399818509288304200"
+      "29285687066701804645453159767402961229305942765784122421197736180867",
+      "230010"
+    },
+    {
+      "158445149514441642839093424327942614083659647608078631696022238078423938097479988036436364797816"
+      "8634590418215854419793716549388865905348534375629928732008786233507729",
+      "130074"
+    },
+    {
+      "-20538064609143216265571979586692646837805331023148645068133372383930344948316600591203926388540"
+      "940814833173322793804325084945094828524860626092013547281335356200073083",
+      "2490"
+    },
+    {
+      "573403296937086092163109531139264573150522235855520849857308891130300178465212296470320575270919"
+      "4193095246308611264121678834250704468082648313788124754168671815815821441",
+      "1002"
+    },
+    {
+      "-13844828515176396081238346585063517228531109156984345249260453934317772754836791258987516540324"
+      "983611569758649525983347408589045734176589270143058509026392246407576578281097477",
+      "3404310"
+    },
+    {
+      "195334207626637530414976779238462234481410337350988427215139995707346979124686918267688171536352"
+      "650572535330369818176979951931477427594872783018749894699157917782460035894085",
+      "66"
+    },
+    {
+      "-11443702211333328447187179942991846613008046506032421731755258148665287832264931024781365962633"
+      "301701773088470841621804328201008020129996955549467573217659587609679405537739509973",
+      "5190"
+    },
+    {
+      "416616155466204283188495959325071729739561431818256141204818068407740780331759127083119461929383"
+      "2107482426945655143357909807251852859279483176373435697607639883085093246499347128331",
+      "2478"
+    },
+    {
+      "-13693479104867057076456213625128243322203607744765943483569387153666080445886146575574361317065"
+      "43948464159947970464346070253278291989696390096800799614617317655510118710460076077638883999",
+      "1043970"
+    },
+    {
+      "112425181661794129002648485120629998277472046771286727529204370161882982670839574545965417071836"
+      "3182143418314514085426692857018428614935412736063946853033094328968069656979232446257101741",
+      "1074"
+    },
+    {
+      "-61731364540162489246405222722634709601995593282906553375302020558533977917473413123470301419065"
+      "009937527006122336959545328160182077217318182252900766702134811028346472546859119172658189559323"
+      "83093313",
+      "7225713885390"
+    },
+    {
+      "427726927934919254113730440062862934832746813582840229166168301862245165998959551071291581043623"
+      "8721139546963558655260384328988773219688091443529626531335687951612545946030357929306651006711",
+      "6"
+    },
+    {
+      "-85732133352305618013119443734793321643140330573070535901546564928568143231751401068602907932447"
+      "965963464238480906171131948102003071598900914059517055695619676231862552964572351653207627301224"
+      "4047",
+      "1410"
+    },
+    {
+      "222586460984369680506396022218163851815965679185153381699466705005996122257424875950127758383873"
+      "315504747512122606361635000867874176409037708073532281574783395470414726798808902921673535341007"
+      "97481",
+      "42"
+    },
+    {
+      "-14158277750623758793309386870401397333112823632717478051426522029712001260747920789473711562165"
+      "031101665618225654329210473605281619696918061316240634857984019071572591940586875558943580878119"
+      "388321001",
+      "30"
+    },
+    {
+      "541155584254425979613188554619678727798783748663875618414914158878398977451150960873342906751738"
+      "375070629948682270217167252220310673099358124277782586420348723842947995728027309390402531995056"
+      "9633979493395",
+      "12606"
+    },
+    {
+      "-34646575299758269969019140575095236687192319234095559348648571537039215489410200040698016252172"
+      "849250191759801271140216353016651699111512213139854202905628695985772737356840241702031976191263"
+      "6411646719477318166587",
+      "868841610"
+    },
+    {
+      "226918682516153296283366508696835996738932142929758833723298675240976541422347669686319975998161"
+      "181766073575383132390045649525396183717592431210887291508953497031060433163648417452639972136596"
+      "6337809334021247",
+      "6"
+    },
+    {
+      "-62753135110461193672553106699893713603153054153311895305590639107017824640241378480484625554578"
+      "576142115835788960865534532214560982925549798683762705231316611716668749347221458005671217067357"
+      "943416524984438771831113",
+      "171390"
+    },
+    {
+      "885279148613480049684005810105305652205445264003395484294398439087211963495794940692822856626534"
+      "659899202372531625556665263858264498628630838340968230530480720029861842546939913366995934689061"
+      "11158296442729034119206322233",
+      "244713882"
+    },
+    {
+      "-49838404942833341476492863214039966210849588745720667496805582261726366962152368756886580230221"
+      "099913260141269761327939105865452714534051584009929047802635038280288437171235933798427412286115"
+      "9800280019110197888555893671151",
+      "1366530"
+    },
+    {
+      "225052532618726454590071446062888513584105044455124711622263141168154978053023351606995753439457"
+      "492257929060818042752031823562112368610947434388785794461184243869839988529515393557495827502171"
+      "5116120056995036417537079471",
+      "6"
+    },
+    {
+      "-11063664425085690359097648142279487920051723129954099471537233452112866971626419633381102570974"
+      "774619321078682011436902584989734572253109804276053092265687889155666478216846509556313209231133"
+      "2073097630676251482491663634626858373",
+      "281190"
+    },
+    {
+      "252529266889140492027942702666896938945638824938988933945560431669157338428467829362010006692436"
+      "169366644472233874383919822134793165191680765119880093594249303819410475996720807371128467104525"
+      "5047521429204396148980705984836743",
+      "6"
+    },
+    {
+      "-12407390668433023412711473483696990726334795896412761472587854072142800403373577087021298541061"
+      "094633377354326966623278849423631924808044397822651135905640812063181221280972334965193338438214"
+      "107578486417026806166184210160001817890901",
+      "27030"
+    },
+    {
+      "470818136852949261411064419795183731720261060834125720420669319524124520436082287591061301043357"
+      "213322783174109726161883320653751919888581225434721915048200554342299722544020404147351818763644"
+      "2241332621804718967775203938403965710395632762155",
+      "9225988926"
+    },
+    {
+      "-18561106699473882683893610406897640274641604604366719232531311768532240877419243784324034427103"
+      "982476422469022128187496859743366415292401783981242355554376252514810445260249103561318190166700"
+      "47949661636539964662370375622630863327168696307",
+      "3210"
+    },
+    {
+      "400574893007015286193582676647685618070647722744862226804205274524579824253977054633978989954616"
+      "034159006910946702351708557861898605596918720273187827168543246070884111850631094386559256879136"
+      "0294244451765746911808994482063783730693703607",
+      "6"
+    },
+    {
+      "-11993122770108617858536443322964878003618156069559794803117809279608039120818829088000103355036"
+      "592864877954563564831932363414886811786054601318517206937549605059298307895591515771731031691422"
+      "489377098686236263367916404512751010916862894129855138281961",
+      "15270994830"
+    },
+    {
+      "564641364402352353147265972955257491176368678087170037562742666336650783712235399707589173670681"
+      "133769824866083875424348677819033152278590366155645865117506146982520482120661127399025066364738"
+      "1261360659950519735730925202117606150672170127523599",
+      "6"
+    },
+    {
+      "-87170648099600746513320436797965444744200531896218032099411547648772425755796175401851663060948"
+      "525022237381261119516125256279105175010815762022647701785466087109374740057429699502124049557324"
+      "73198451623024108934373488641161751158901712323446768306053",
+      "7590"
+    },
+    {
+      "133680531585521726652108525393598933403698706519514979761118828912966500080039551721607924572293"
+      "763209936868177554094363992682910953502959686573810881682191334902779142690647238320626154317300"
+      "61224649980566693258603099340996988542301914519271322675688591",
+      "9366"
+    },
+    {
+      "-30182400150813920876209786883119253803999832296331202688726959118075629821111540532358200501688"
+      "299221894019647557759482607244015423197995662377459862455981022551919229357426105082809664626440"
+      "22540839619861091049093129359799053781543195492373882916779852781709",
+      "1671270"
+    },
+    {
+      "316822110890340167043687855821573489332284954078120873879667247398427248439631784959697863027203"
+      "134202419468987146791618689819277126743898222871052507988695629510619743140121735789346089722138"
+      "1410667385636049264583380749631776691121592016493432807733153743581",
+      "1362"
+    },
+    {
+      "-19065029099978881661232019231773858335677290391514131438762718705990577044459391560757189726242"
+      "357646571020749026107377290275176746326095623878416587092660143290054075335219507444491098072158"
+      "08770201247724932231495252981632908042371307965561986133763291349835081839",
+      "625170"
+    },
+    {
+      "126207370449098185618328560903555556240168873196052617629976895710626466497451075324826322131529"
+      "482994911229776907026423863777067999895653205384330726232521594641159180572947113966254365067360"
+      "41542403370025258477205101808063594056759977272469883621048184279331863155",
+      "3102"
+    },
+    {
+      "-22777829627495446477861930938447100005845611455278610435948668520715964400765872357478520226456"
+      "955236765616948569194371563693751520412850559356220324972858971513593450401719557868990117188918"
+      "77065760345722163063921177723102631428767500963315657655779698470644544064472947",
+      "412410"
+    },
+    {
+      "480867224771001697116513683699011649496855159878152931805742068517626950204279499281932407966997"
+      "815888727039144001177194783700618900740782637516562256421883686495287564849123342843286211825800"
+      "198337962453448529082007644439295666002669973893196613894216505936316966183107269",
+      "63042"
+    },
+    {
+      "-32146713359093658939838057200319619079800062834744366367401920436103403931501437086988497298140"
+      "446088827285577323308018648523031654424654116836446834363196922548032479902806701562176993971844"
+      "3419712110857965409179947456994970687005134042835903494172569465751671057323145801",
+      "30"
+    },
+    {
+      "219548280848198162306234273763911549466285105244154784713658316494872694385654421384523757196976"
+      "293948861610861990090717450321483556990976737303775473546317570009246880326744542083860763606992"
+      "73002129330161098228962653466112032300056534380609136268347425707537340996253935261001",
+      "1434"
+    },
+    {
+      "-21219100857918206047856383794546187228737286933313017518832513566089775948273003544814638885820"
+      "596659324720557284235627958719084675892565903864339534439633482134886151859611237360536546092182"
+      "191540994943645639475725217311330828877695184401243299271992552200191141952992829700574385418467"
+      "2707",
+      "9538864545210"
+    },
+    {
+      "453504972831523920502101836282915480003952250254971484084194396063408499027022553504389213554940"
+      "860857287751396338453032575810424813312439295999748584900466316206106590984659821598454767750696"
+      "1593292880902830325868627515047168286738527241360778218692535254144583771935549805772798793",
+      "138"
+    },
+    {
+      "-14806778686788103470621358145747278904909964599031539096126117917681340159089002531976325439251"
+      "575599650990055816398835581259851342429781468735586280105452998791782998569291002171788915241595"
+      "43673803785481607540954533057560554704283718320006046424881681934129216249889269701182688055001",
+      "30"
+    },
+    {
+      "262668605206102118430195944953058387315319589613263079853189811674338644589939356676047394737425"
+      "651989092115424635212785341601958591806782599345416064945113338168378810138043832891536358769753"
+      "916174695061208903056552776976154338169779827414504134808495078925108569042616724875466536400029"
+      "203",
+      "3486"
+    },
+    {
+      "-35074455463752533183426677419496512535169861133496721800954687581455059211331722442400234194661"
+      "132774137858007366824589662124293730958949347520414341197113522151645970948865302784292066370663"
+      "020315014124991662636424475422897857232250644377406550975731609222910751755225514662760326347499"
+      "48001",
+      "30"
+    },
+    {
+      "305398541476219870310202097566753518188029437398257035838426271221609901363012738122606467124897"
+      "016870116484185917763513956122037310231627371098075740929503923169736053673611338047351599358018"
+      "820496680832320177208166869532131642597750371393389493439935134824091841192286305942324805882337"
+      "2368106375",
+      "16566"
+    },
+    {
+      "-89774288871630307843644520580598652632613559409413344033893019938898862113876440183943307724290"
+      "509165539815764354254584162176909463971675189351699717189454959415964995262823025743004001915975"
+      "128242680213612581748367743077774468104545056300803334120339537905702856877606246855867891786763"
+      "741486735368783092237",
+      "303940201110"
+    },
+    {
+      "288475927665009418601327222425958443336780218384521796912166525343199653643741385071648802697148"
+      "074702258018293194081203547275234385399948381645601295755112081211522401848061769539868110287053"
+      "579527883204733070961095295256696235478785408798512762919109488007863543493339156864393027900746"
+      "0403102076327",
+      "6"
+    },
+    {
+      "-10420343529764180091550759280313876989633312749149053292953116663295845057275192902608053345653"
+      "138256874663042880583989860613170550372271256737917283581349758270676379026329737258680437265409"
+      "027141273365440974202940525915613066356041259991383151833840038529076091377344832977351872809259"
+      "5019422753511174189569",
+      "131070"
+    },
+    {
+      "560816935868894622750515894474846176826564862624656938221811727855242183389516419087179801847095"
+      "478850602189080685680007767678343600704293008338796627070692724581737458833163463691962707616413"
+      "251768387381536061759636653832166267249693705096501283271578621212755876660402900474523038599428"
+      "85949047756404247033",
+      "42"
+    },
+    {
+      "-52185074799615138018905963924212613610369356243122583250653791432959483008120407038487660958369"
+      "745987347624723006386258028842570827868839566798249640108415650511751677174517473289119352826395"
+      "839723724701055871877364950555012087015220999213632393173736178542170504356707139363579785552467"
+      "79460902210809009009539232173",
+      "2291190"
+    },
+    {
+      "622550040888110279751004332803496946630442596485148079658896834534561624905603547908048969132352"
+      "959776937712723791032662610635363964043086266275827603715581831379736192606305678462935734624605"
+      "008567491048471233121195548340050738694449261417549751282380319150802908818845820530567524435127"
+      "9445756172428826335261196513",
+      "1578"
+    },
+    {
+      "-25979004081628960587105726589498185244682192669312918354799594180948901208037074689002813251247"
+      "045355274429081010226159305052120280939800030619411634939979483674733012699371525411902546788214"
+      "149798007597852152403087730605687705633337526147415796739090613225744140394217727739519073811243"
+      "89083123642187877106727324831409104559",
+      "374416770"
+    },
+    {
+      "743337820546538894237434692131526557991431731044216817199531402800995392956733413976365927247137"
+      "853973343729917073065389318854618909823909913619556446903714345180086262670567138988563504494715"
+      "187706346245681886987341996878486341365778158840076516605461553766026518781998473369756690757050"
+      "29220024942988801596540479832623",
+      "6"
+    },
+    {
+      "-18121528775296329759164902885826628159615932054330150400342559863769706153804052269612601823798"
+      "365932970051669673914884135191295717452578531541414442913659155413121570056032594973325695467481"
+      "314969978301631841533809439574315293254272325683088307163832595736919499105519777685060349752750"
+      "3600109515880553950890416293966947553269",
+      "8070"
+    },
+    {
+      "304652093569699557351582424227270111775477430579008410834478870463481039153775224667338604913378"
+      "382139548609623914841564172219962317795636679913331453104140202134556279925445988685657134103647"
+      "044753614334935369430918736361622260584801249029282896383086802177414096389808044696195892779475"
+      "0526681977409210580806334902707423302910890705",
+      "73743978"
+    },
+    {
+      "-53894792870198288590122004423433261923555090123821679974442219394992023405819324285337251403239"
+      "394790479999494366822480012449671547071048962691366825823925821104849723394085108222300354124301"
+      "728909256582301520849549038261433905888543184581857295068894172448913713854826606588348929250895"
+      "84501833253476537744400283864408173645832802729",
+      "69870"
+    },
+    {
+      "876921640102601760383168273082801324788039055564836901409234298002253995782034121007322766508391"
+      "364331313364222035613918206397636790569250311165509441010945170696883786500399759308075144882184"
+      "008248023432975450281978336106603716700929424210717924897570827498252893067062775490058563356806"
+      "930680935200945326351681714440032862515566687",
+      "6"
+    },
+    {
+      "-13881827727534802245242595435384260232947811201198407667609939504562972565375367623583141284254"
+      "359096353980778118825391996627114711856553358072636756492428173490832774755190357868951071267640"
+      "494075493598567122492351235864685925413281150997608511781357922622804381689654027749281367895511"
+      "66963401124472782522202058296880872854126156007513528607131",
+      "4940319930"
+    },
+    {
+      "328857427279132598370725819664839537059630575834169974223889322544055053987991009800242616447893"
+      "566775966690766963898661670913779920037716055951612581279545712499250778556026626546917239932911"
+      "324742106976560473082284930318446400772765940702148679818892725313917604616677818147266999416190"
+      "0278671855691024038916704559966546186751742476372279",
+      "6"
+    },
+    {
+      "-84902282425953111991199205658490097602177910235727989182663743505502463662254351445408958629242"
+      "698780965263768889888964732791909554325665111734112057467123976921878875377794377181730501589511"
+      "059242543228757754984497914367693119677413274896369856948742814605160820752892957243055128003864"
+      "56299241907049270636679469815489106102786158831873003971980149529",
+      "7828173870"
+    },
+    {
+      "258755934993481288332208572565441338431091999426291726615715758318960090027173793149931105389128"
+      "887599322616388833977905312995850844269731569137799157818485563115558189277550714226378727412391"
+      "466965017246647885654192510025002480363963126562979934219968114070293868470634397823116179818182"
+      "06546311041142991312322619717261878315979033851316268092742291",
+      "11886"
+    },
+    {
+      "-13295996358352661255842318299770257824204789208962575424138758702193899502076656398999018598710"
+      "998206478613627640240679560898154064413300556884559873370102726713493089587220775607893710741660"
+      "512332309274991118076352427194097515731256809193773918568106617890110582238573956619101280583583"
+      "9265694429000135104051173197039224461050364993416415448157657001",
+      "30"
+    },
+    {
+      "126278634076474383654365036637418027325807360984154344178778167568854188198424926836032501251016"
+      "791828641266571078533249500247025672453545120151858426136328454462608877814028135357480684003645"
+      "692740424404849750633939325832438637957404856278182520979962826152749259155504922969148153871308"
+      "1331723845462120745928641410668923052992096071568118182416749081409",
+      "138"
+    },
+    {
+      "-44261581220159976569180812286675898014998089409708979243070868702526468759488416522389239336744"
+      "890657868066723423215370127516740848218464586854296181832145252892766580125943491547962849601205"
+      "964238118312590414109656617177099586590621475345831716711416551820165801993644854496297324384695"
+      "42501153689517957906763036169880300563526920600913900347892060168169080524563821",
+      "231026334630"
+    },
+    {
+      "158378960459933745353732673983377704622086418682000111407542005580986544145352715435649528631197"
+      "645211762019722767661122078958064217177336225880988737955740461066476486097551548991955116319546"
+      "315427449493825430704787375985685635337262886136570504412827663590990198163434342208367501561777"
+      "230870660164068668650416176368657029205310526817730948015526849382859712055",
+      "3894"
+    },
+    {
+      "-76949627123221704856645440345111965377390635489206089348129371378410795184701985731073976777046"
+      "307651656057524961962165971898564612696403965998182557764622530118908228726419813478701353817417"
+      "838395849447373427701258680935193078127734529094298582769002601914474898611631914344896299769866"
+      "5018791994064217597704711709748695678908604180272686662449493086793580970828093",
+      "8790"
+    },
+    {
+      "344977368185637380304333898730614153996525419281986770522385915720139215554847760949870834982202"
+      "303432587625997234795118134923343663265548204594792841811439303451011251437993865656175552484850"
+      "145014444202587617378736472160288579064961864004275382498994164923679644150818450558302750885234"
+      "058860046684381556954878962153088786251490404112306387375170114820733240249707147",
+      "1806"
+    },
+    {
+      "-18885755901584959964401084339267889588594504495058270691085292219117376054910942421281803049663"
+      "561651622901731030440927025822179597721781836062214168671403551064767990946535511234698279062816"
+      "902280476046778388084857526581969649350313795875565304276803065378797203774793108173185847447115"
+      "22453387072627648438830200285728320936098194745411999104991803838665658699650727659349",
+      "4470"
+    },
+    {
+      "568317561152869660708006247807250182070325080252096361133974001632808414508589817525161635934316"
+      "859585810862416776213167968141697789553602500376100759891317727978927107188060064388530290767057"
+      "228836881638543921870779372555512626937709064548401318404626538932971944952366322152909276489470"
+      "3813815177897980268745011893371899061378940560801507189664711567121796987700152153839",
+      "6"
+    },
+    {
+      "-18638789952048590119950453418481560661821918466359059375187153206557759581743605231349907569223"
+      "034108104826005287694796420210012184158790061643029553704608291464348079647177371953569351441515"
+      "834248331542500477474335755849990291267751862933887215149701833511298099769716032276339304349238"
+      "439848295803115933725653985747628800282891676355700124156069413679957022122115195617070465054735"
+      "75241",
+      "866054419230"
+    },
+    {
+      "297329146520053263080690382990468772281659474892857753982327755543268216549972842549545414367597"
+      "556191869298188789624191797871606941483604518179978113231893217305704368472385273922040800836707"
+      "137461041231809273634503655528337433968870029668842968489134811327855866831207323698585971530762"
+      "61127975076406564459518695821788635361711463230165952857117226399909961673058570176834883271",
+      "6"
+    },
+    {
+      "-58967523029715869528178801375535480375229521013857178622198695979595407147082354062336321225366"
+      "774464262462956921196844860368892353996875539794848862544269335876370804510037897699613232981352"
+      "579536578917217268540854988864027790319217013641804271283467197395422033631069206034361852569708"
+      "825449477940420431948151136936008147461897094478215070799609204121013171606898069362266226811060"
+      "17",
+      "510"
+    },
+    {
+      "689735739192864790938869842200448522491622174065530181755219067505817267965189978776569968680399"
+      "983089600630968341102178380777713630583306140103562669027424552384203113812510243331805627699809"
+      "267240054344772443480095752572066698167737729190346148297831547431732607091731942172905658944645"
+      "576233950351675859756367833238423434368779109181349635099892383418900862720397266277623080279813"
+      "067604999",
+      "25233558"
+    },
+    {
+      "-13100283138785679071146924959083157031211917559111311119843602680103392919585277896322814259877"
+      "204200513048105433736578815747973536959976256255769924352509541156474190755449447360548540157110"
+      "742488736861553733277769463486445670491299841448071987802341072787338596281453347319521157985517"
+      "681018177534437360236590803482490014503681404370835830991270298705376782454501487111916807592146"
+      "84176445667",
+      "20010"
+    },
+    {
+      "326060623527685119509943704770791601228005470937007771505231289601147634706642631375690614792997"
+      "632463961748707903818271831585058691299868189004015410121702360174635854844213935688176120949187"
+      "934444814423547102451991673028031440640119705775285069412480178159820513333826942625956461118235"
+      "807447513926664677946033546970055943488454040648529963201334469035270085004893561367749336415260"
+      "1347478976955",
+      "20526"
+    },
+    {
+      "-21931022192349608512492182380840457515521571951988074381726218735984667680872093396349619328732"
+      "044131213547998124308541078032992055259574625170697945292955424940928320898831030553117958335524"
+      "295334473124061085211019948034784218328090588160639378688334766157874711038071346890086062662745"
+      "851773579782072910105211379539947751637633050888910210616306772000397333935931430274985745331562"
+      "0772706780505888813811597",
+      "561706691910"
+    },
+    {
+      "583196321165522746909636404700087978519135693938516160268026999487925708004265149553133462036989"
+      "943133118975504983324268417007316797864310870601916632468844711222777875778441595662461445780848"
+      "421256813210893747663034424053574110541569291103276700103002755811885585505795208977791085358642"
+      "307758278183106055415717555509523363007690145563107391988802071146528369753692973289956876952538"
+      "5745975473155407",
+      "6"
+    },
+    {
+      "-23306762036180954707239902303733182709978468580325093149239040051634149745258544596562134540960"
+      "231525935441270015799599621135682414015382311861534597843756730857227145200622246509066032795288"
+      "017634942726754909458234645264430702930529842456653080378544365215066466596986953601385998432554"
+      "535709196917229350478449221406496506432167664369239478872974247912601100426306339312275565475595"
+      "669640092216631914518917",
+      "9510"
+    },
+    {
+      "281229670901952879810550195237464210261746111546066078814108345538215711956000771563881395040508"
+      "170723183521353360149371335044883445910336373788751754888608421422002155449524574622515517283055"
+      "458627031464716474833941385057429898633362315957646003394188662183226812852669018179772845695730"
+      "446045418724225177361957030693830156382145713785460923209113823851416341601568617830951146736552"
+      "12399723765743717305197851",
+      "4494"
+    },
+    {
+      "-37218229811479635434736287217181603896753958974375037792268078604825666912147059590162399518901"
+      "934867582325375975916422796544599208577160186019983780157109674580025076608606245689244483284525"
+      "608083767962245418996857568217934343211388385129253072164205547039831711715407953871007998093533"
+      "905191076477179762130327527528151598157393221210415276866767743347823281587733144522066786877707"
+      "45486976844581551304048486668867",
+      "230010"
+    },
+    {
+      "119470112025136837677231044892714710978685018733997588875143369345928228299766467021619093096802"
+      "376602019986692946175520096384642444327094416513779796276967963858882633059158119246167943030934"
+      "495504166401076413042315715523222043632291104972992360343965836819066579851981773029725780276881"
+      "173824476618480834762832968933566379909999766070596581902711013867088764774559688802711813534490"
+      "21120174672279118531405266405457",
+      "282"
+    },
+    {
+      "-38293938266948514423679636053459864146441231941490551267132383695211998830325843775561639846027"
+      "759658992946200281609482095042290981956042436619498597170875505407499412061150205464900091758847"
+      "003071995515741074078554024242076867751557265792454970218345516996785538046511770957862495936722"
+      "362407444221955537113329542049423998838793290515966646488710554989263344110331259953108731512847"
+      "71962309916237507813788879633942447325937291",
+      "34098248730"
+    },
+    {
+      "180838307251539286213037013563537200013162679309314888077928764992882029376850859270752105562802"
+      "770827616582970567083806403106857452761293079907898157867679112901521943879321373403686342611036"
+      "062390075785581242602354115977490536551875669202650821380366878981957023415109458621164019663349"
+      "961706394166147086047956000347487542767906175017384350968552835315182614668440553520650493613602"
+      "6796030365288231301797295663647612503",
+      "6"
+    },
+    {
+      "-20389209557321667045635446758715392985346645488323445949404192110310046862448879801299907228334"
+      "819069965749950062722837729895522517116453395298246746722957213874449897651970943566256862772587"
+      "598875290638840634417294644666953048171548797539360133602448144701712553128604200524594565959666"
+      "773961651323019066288183077444549449353888349251083706785927354944948124114388000131004422267048"
+      "87804736057100084506757161238437561170752083",
+      "2490"
+    },
+    {
+      "164507402617612014882865140866663413858444125808139497240001550383088701887207196581198764512079"
+      "310327480308111899113384034952018799178539400077783445223543411867488322718098218284092982079687"
+      "391392270146095981067032374720432289322985638009843968659437557957583690829548884373028665004080"
+      "971091630185556556976955941146881924211415993136891897784276903596652562839482572912454645567415"
+      "56264558183330312680675299274129472749543281530376155",
+      "7305236862"
+    },
+    {
+      "-31404740573139387013607323899060788461129734403267877740839079468522117216337083625061725107066"
+      "347029224470970177830290797457104821060170534363148276651160571699094881049180803660482733644591"
+      "278636224534484481850814754420273709821201199908209760469191567840252247706876075856090781209456"
+      "764232767086688491357087469900906692342923336064928179724546370791109956974800789303951709599892"
+      "246386582961297095349501749155074025993332911366367",
+      "5010"
+    },
+    {
+      "105959450712139358561614326750678748291627849550191512662380413294068107407247886566713525350838"
+      "198788534238121678429166419664041236233803606051817627731575939553790154021616196778501189528768"
+      "078400811107009317850171384096998455082824610437919969197421385189475358775596537026092374519645"
+      "052975059595487888618614275545703577191947383711761849232715855501325445057452043875112980841528"
+      "855594013764288125280661970576229405994478822053767",
+      "6"
+    },
+    {
+      "-11096835851855675091056900605910461243632230479329019789647620819505111397118730425667188261320"
+      "106354371088749100698920321346886209572808642132764975792670637537316003247906088141428531680505"
+      "004999825009662929869171471233773103313306324489483365057422142133547749649433179002999712892888"
+      "327045291234359575683575992108249902771563318748350822717395442100744573907645221523446395395202"
+      "9377612275096135644427285378787750547213980148328191792731369493029",
+      "2203871994870"
+    },
+    {
+      "871667613876289947152259213998641324359438367113245978510277002562210922288209180150151793852558"
+      "736029189876363096736208315035600167649273464678134646229708161579214485318416128870291425640987"
+      "624153304026736765522468963515580422620761261195314156252082303726799452238319359220112879725078"
+      "451979791840912313059346932550771416018721541922207119333620480831014488368439858212426770461809"
+      "324187079997350701358985200574078187666941445255865364959",
+      "6"
+    },
+    {
+      "-13996919937429453218872969370257700000046566493437117903588993203792722263061516187100856825876"
+      "085809356021297095551205798370028490413966298879647158884383791466487133901727883452491575071706"
+      "997348776015272296636310318052713919926107295920596057060750434567267503342681095928874149049165"
+      "813309919763715174135465371944879525550512064339416721421380683778520762607799122638334477442228"
+      "3805854628774864645574223075309564129905544107459811288704862611",
+      "330"
+    },
+    {
+      "999866869350557363722458479004395830847953169240152118030482972984856254139343285563059710426142"
+      "001310818604300278555911104883557186325333153917124330048368249458087059040520529706556642732809"
+      "436335612822769043297715578151918469336944179483860946506334004186007324467864842978559250174108"
+      "263899703085692274142353761805113570952308838426945093917953996642662776561930695988488695006166"
+      "233701104386823791719249365863288962981240951731129450241042813203",
+      "798"
+    },
+    {
+      "-19435667946412236600006355752680318177378018998686558693047046847185922842569405850478643326624"
+      "807107024135785299799674685846584030230598008329461654964640062557602833521189158599030670653044"
+      "302429200521250792329717629531968392422269289900710918148435060503372045597753741275339144955223"
+      "007618411222546697775810780747446478661790743019087588298611993809224843559412437328287256779856"
+      "482337754827908028601591041648043989896358637724179061858684905231780173",
+      "5190"
+    },
+    {
+      "235748150954047015750061383426778147376111170021891688845146255881245910883215587004762925614952"
+      "663164217507306817544268998903832767678874032674806866276762686859664936770230725545347704885864"
+      "836420622598430157374668204179638548021664582329680823828362162120638448973125051055526263788305"
+      "040144520884339262399972582801116202897933606321412120878779459660750339386877371328290404824384"
+      "63044913103827680386355585682702291192692673999705957317036687127526488661",
+      "2082"
+    },
+    {
+      "-19469582449264085198199285400353123197940252311543122838469414455338338856848841859386633597492"
+      "935289226313513798852883205447465585588700846710275435424652688012456296382730908464900146964812"
+      "930581729452255732499201813217364530626290229816884332335773291274599287651136063001766488321098"
+      "751398884549873268866368809884658784106198822375967811523804893707242952577921043325036965828253"
+      "73077048086525583941198173749084587321884232599450628448598711165788748886648206781",
+      "56213430"
+    },
+    {
+      "502172089109637973079905157308517324166048351810351159422375337574332573514046742139861365117790"
+      "762795398322755462389540876498686325519933386024542998456467504352201616875674226702066988781736"
+      "776780983675270711591178536297327588046501114273115924942240089195877277170211145955479537604561"
+      "876530663522061491492548171664129861255728492613537859772665546205365872403842851465588616941966"
+      "018356565181922169705164734493393477247978508055348618032704534473742084629023675",
+      "4686"
+    },
+    {
+      "-12359561245816347333610211154283867476483183549533150243177413535105007409660645839018994794985"
+      "589993322495638209045465950652373385284290988635132496627468482309183354235563610377651291484274"
+      "983125139258984606382689516336611547002063107605480007149663462290923330370699799512513012051585"
+      "976283946919396000128468579127746706923053995361653453254989844882738707127566785716478776500725"
+      "3139087944551495091418632200084873393873944046407490699550148256008464127109223283763137247",
+      "368521410"
+    },
+    {
+      "445869588001267867904524148334517372764852692176040414939578321538477487766910195634438758738916"
+      "857301912257921598085081444059552783094118393374017592783961746096241926858841239939685011047671"
+      "843464779390679038465124395229271596498987619658165252867917288543464856867274202752925695113115"
+      "455877050528889889691400313300031512006014327098936138027297016850729686810907035545615256137867"
+      "61794587069881004247080811531298610122589066840923344874780872870506826198179146216889",
+      "42"
+    },
+    {
+      "-18249520604687390491188873019557839254274215818941916557220148305863171323999328631073000715354"
+      "712349442824804877473011208435647924577393976121564194070391790525169749128982828132077146902780"
+      "721841387850162775862442199934474879939605150425883830706636702361084052335568869843628198626221"
+      "242494076538767614229186803516353130263179834649242288787960314531149564506544752097614513847899"
+      "020629776701115098262552562151629993531946710430672386743677617308205579019072302696542508379",
+      "5370"
+    },
+    {
+      "236981464930893504322802139851626699592628411111024705468714562373236936184359114116421846576636"
+      "459712777920335379063477621836359011586413752593417899197603105681460352445932378792454366478006"
+      "099883273862981279429149811312127273076915557845317216232626859123747826538028989342009113243530"
+      "964905487060439628524659079587516495492222868853393802686849471730531810057511214889218773379759"
+      "92137735046528729900037937548187674111044469106308867226010497700021930277136809473041010432321",
+      "2154"
+    },
+    {
+      "-77892092556352008902327788771691983929851348613545504749626511915147350546473495769093763504839"
+      "453729441597212242108687747853396741134899447417138825607414503523779780215482276161752817270001"
+      "573106865754709267983609554304217968136499196842513823853071025258517531621809739090569805473939"
+      "360911760566974188186802980523798377222832242450249158399508406587878710460954238204505018557702"
+      "357504954861644475014053958267630939139585943626066477864173370849965704755073932530073272268093"
+      "2200039559718809",
+      "21626561658972270"
+    },
+    {
+      "715341102258098940319912343996707811685084551356244645540933308810413928160891724298276851619649"
+      "551829973697033587181069271380692407132317161739109284011945227649892560360729074672778640720680"
+      "874112214109997197387525352062913504682830983772725393570468326491083187300331970668449041594296"
+      "073065276692887678729691114916079642579900288026881432235979137544823640729868705093774645241454"
+      "622836223176904124630526882732099120398430089179339282190314646212515622936459121100998906169917"
+      "551",
+      "6"
+    },
+    {
+      "-18399470428456050908014333117886494595730651014055636288722717429950917809500136272557117402977"
+      "052839042105693597404693257617634201600598895359708213302738206862242849606975947076539483777341"
+      "046657860376203296993121539300815161693660027527850273081527494673550440357634430596208643360358"
+      "204371232957151165657607509017253243152916116719712350843286172274487990507840124030754833011930"
+      "721808729659207188165402273267771908929719004881279785191361391914450528631012111465559730900716"
+      "078151518537",
+      "46110"
+    },
+    {
+      "208132436796701974026578645947003622483331056287355745054077487521943292103633640299040454986839"
+      "202747859043917118863682964912263420747609368917895299528283537128619646155369384340380796319852"
+      "058383198301591487844668907655774787107504112390867072793141133404235025281510895382567746572928"
+      "950673725604338682612859326696437844619128850349843527450121343248512668807180114664932080245723"
+      "088399660184314807010670380724658486771064683185071514502241671483171013576410513348441511540356"
+      "28560478914687",
+      "15414"
+    },
+    {
+      "-11072523087988132187956805481179752626711516618653830902982613313730811527732420727057104026344"
+      "192026238624207634205694904786635353451426698002441237043422018735956006205049344045722103544008"
+      "922604669601469021912275106915663076431336096076158785671600069013109857110590804523998808170490"
+      "848166012686380976324375781606334943102133253663258729865339977292053566107401323967095342608874"
+      "283325265349976365444693844705084679004587031711205053444484096877881567670717595463105972859084"
+      "3972403931253118799",
+      "23970"
+    },
+    {
+      "105436468101926712183015966237342027981822548065378183914917892056155580681320203026900330529498"
+      "978410421348989042633250982811992039971268918718464971168941583528038472099497987423279686033847"
+      "352373713634524328902029631237087627685630315840422522565122391280523543475578415123567558920642"
+      "396486080328677738780748081096335514622972327452414694848941788411853785238697682675444724646915"
+      "348071662104156310859630089274744684862265845975500290596918123665582220429778397569235238131206"
+      "4835994355860201685",
+      "66"
+    },
+    {
+      "-56868988747972506254659596935683883463716573524427146597376366171981802233487630537261600452515"
+      "928180502785214820124586232687460333822056190451678107485446400177877446417556715711032055230455"
+      "854240595868388654451080202675047744244991416192115524025084813812227930163123287145588705727429"
+      "456779082968390877093897979160965323905993195706278985485896440595636775123847679345910845046714"
+      "163301325224520710766325936895600819434580574518875433796519293151389916795779147962584026929392"
+      "606854485528272956190655743",
+      "1018290"
+    },
+    {
+      "272335219988441174665711644416817037788222316888226564189208490175239816964949116186510825827071"
+      "430823770205468882164078844664808347805830968230876961416199262466469270666791566377066677591980"
+      "435489655129480366457251098317170822303846655426605965362124131884076377822163533931299954525682"
+      "197137509183234465716344628166664461061213432417726255707234519256021790376040458134340655641181"
+      "955634260392208809071001560270930905476873636208670386352442356434023554492321216980902574324561"
+      "31056504444320853157345201",
+      "138"
+    },
+    {
+      "-21144886325968847421136862640933605790730878065158231117894812330764874940817232709655287449203"
+      "776974910988576503561661800249278991319113309582335281592647442495030553208258548341339318764197"
+      "461147432848991686338242711098654931144304725148541437215370995347051713517773502906169174089944"
+      "259231510484935144428438091067266131242394201122670888252772064856423958372374082615970685597386"
+      "991737179844349495505700142239123902982043714578671787314293339023048726217119025452344630237832"
+      "665698519639606247957083240801",
+      "30"
+    },
+    {
+      "420215232484149085158219849173415405489891098922983569241602779548148546741181251689236609534861"
+      "967333749055028042598969140909285617702784689342787873864063319780937598384842703648747867883936"
+      "235575961080852921211093650147700809742931981752992799377621501168553326143241007779172845839435"
+      "134322891281282911736199769779343344890849053169766072589382951964445413996731875824713537702544"
+      "435217008916655393980145141973517955089130955730531962484492375119815462800173963869199820652928"
+      "9924753014269328705445340396548203417533",
+      "1651635762"
+    },
+    {
+      "-58501619704915051642960675544028543191622331619179803368718106147066715050953611367125820105471"
+      "786622657016997640185036023065969969930196305774316637071433925900098105806098867713284437059053"
+      "896204424709229753767290541098564831291179653501045065173358307512202884798658402542711306999377"
+      "834862930655450340774498005037705796906117050881041292791993078963743891638376363647544327495565"
+      "372555896345482499897693655950433738779659670972754753872927763302254513603238686082514797315384"
+      "6428111580196229784765036789760566304701",
+      "63030"
+    },
+    {
+      "786319796092893450554695011193950083791180965137235896345688770047999272024958639459862838236087"
+      "144698807134862378170374149790360310062353830250324762620839643879732438980608407229360095903011"
+      "655438122640893141975156888387279010186446870533894352899515156267403392087586823750614165971959"
+      "517592904586972986027701098184536659472888737489727005807698646495449468172070719040780634549729"
+      "545772084639275300568570302009860577097868105330198386061748720507464608374758342605660554414103"
+      "95805129523481902672214740177851314801113",
+      "2298"
+    },
+    {
+      "-11075416275640217215301455016856697298487692508369326483114312754443271781190499298407724023135"
+      "185062004544215897575247620943794500392129225728965590611217420829463050369195924100934681462677"
+      "996141725794840014638901114092921099307567106940924561246537201480844384191896373245497963561963"
+      "419676551406556976540602199595124036402027007041143737718708135304593183730285485045259289352348"
+      "229879913669813358585507046530460523465482162681784716015125227737121173202197874098111893533181"
+      "5732788765628347320001270460720535171080710693555387",
+      "868841610"
+    },
+    {
+      "287911488318660962082672353206827610413984544982589401994853067608661834988323324513908466341692"
+      "945876059703666741371797853002147214826407059728607061685789318380725915877198087771183697336447"
+      "022728991956882235888659007323457891007577518406036718857731183261488700561235440006367243962998"
+      "446573535822653586553291070509424213270063526409629620505237062683825267741874980151807766428939"
+      "026282896558562307089700264076891047932443887866093895344106726376456045227910893045747525802542"
+      "5810584201571774449957241464340109525100976383",
+      "6"
+    },
+    {
+      "-21299114788094757397153706724714536413292077775222009197296487570276368549767668483739905654759"
+      "629794289722059088574391474394384116388842393472198779890845792835783368209072403070166818305644"
+      "992935634095949389005892015797599060514475400351300665686095027668428158520105490245612578226308"
+      "332064019874832238296603858849991741989885454092253889660892754436759635904520725519771622791567"
+      "806625636568537908996210911982475409155309551762403125143065067389753960600797968698009862634474"
+      "184891040512288957749239742206998790145616588343479389",
+      "11670"
+    },
+    {
+      "103955441220430406099905047184293587166423823612952503105062119790467319025206181630607678300465"
+      "219261613352777472349374939446154581613775167669116563736394493048382631903692742255314133010448"
+      "329629034247650705334420681764871912900141730117973018290949463660679599557615656051706023584759"
+      "269518272911302323897521884391299653877954374764999935825260459008934511892125710463944591323621"
+      "114902453821635861655611589968733715513678100756311255168497746510831950445025073543747101134098"
+      "7371661862741413337000516697089619657504784045957077408711185",
+      "148218378"
+    },
+    {
+      "-46669563202575178169264801784898787027193871489002325225279123397961887144097766638563621417199"
+      "805028759708069457627129371801444758876779925581757994813015860192020600281853070563114326873197"
+      "998541353402410622313952599196293054906353542398900902170725578907915286894792679874966992635981"
+      "461714958932030134855752275471759701317716028945685164959866130371518636665773906707651659334225"
+      "647461689969944131254849692510711894112622003445367468796490163284225239013749165694046133357570"
+      "56186544409616787583076594896302119414868190918059336879970513",
+      "171390"
+    },
+    {
+      "640808912350356174378073333715330795309912947431801296035514496305956924194050478724997308276302"
+      "531933458844716623312895516343306208024932183790655351844102967791249508631724180677304236114904"
+      "329953319103713608769803340518450516179464461284806009110502342220743568034682133273443656465906"
+      "102058462073733441986152637932219455262690498783033366796807895595451968974170018589790265173871"
+      "732540219203496470134837096254721957294282692027321105998231580155273075570903000709400332769684"
+      "568638209079266772432973508791091418552966827434770217964847",
+      "6"
+    },
+    {
+      "-98872162196656114876533219362632891391774839342005000436956938726481191695417122725991435991920"
+      "485003784886516420949151408274403750897124053086048470809705387715020563676318491207223028465413"
+      "318847625119271235350352217955302858427960756286710348612322463571556662841990100314844270405671"
+      "459605112346068263402145070889841697007530455932282600691314028702416310723147417755942945877131"
+      "986599840610369192441659461647425950295710718456957848137284733782503430592302360661270817820862"
+      "416426647830439342025098395116603056716015807642935747540566951812504354652379",
+      "233649143825370"
+    },
+    {
+      "101619003132155663199534215913886374023281804253492110488166989803190728169035211453457262211630"
+      "841056114503434432211375276907228563832097081424714523428753465396668635584828350191568047516691"
+      "169323227550857214608779387901814143411744215836301698022484098522147248019397667016267076622299"
+      "047970087797064375788743369973032382181165739687722169700364895613737474076301103620208218196808"
+      "542089296071120138556683484262445969614805973815951370165282708156036520187784573149198251820327"
+      "68360703403384404569260876760458965758437801728169587522360995301639",
+      "6"
+    },
+    {
+      "-63783639210289998710088973624588233946566075008131539459746377225328551512763402330278905606150"
+      "965942861218654753440979855135225080751599455762303374322801376784474875903535720147084146967619"
+      "965166480436166324915138652313161158459147438440579563255414402868679468643443725452316589751257"
+      "887343519347376962412796543353378510329227640325960354800434372777469890448460017461964152127411"
+      "007649663198873691188302850776549851095445319674329831032713432828366945325817352958745749412125"
+      "525231627662590308189489017131904402298383855303749523779093820302379681027746367",
+      "9315635010"
+    },
+    {
+      "117423983553999455219049751318236053503238758360505726000772200488305910255795814470494067428749"
+      "230422624721284905998983391025044512592203212766543638823953866169848798193251300057957776699932"
+      "592960622329147266422457617829171374287272312763285399416954358440327018623988988393431176607780"
+      "378714053603130960577262099472015817743248125473787750109518440297265691774517522666191313087896"
+      "013861873084074195816378819585090156084323257364071014313800115972968251161029118723455461034662"
+      "1711370121346135534129198492308718185558865166313048808914617330314355609497",
+      "42"
+    },
+    {
+      "-34590389184269498073201504849339569458532431595953504130530756011224705219169556649738299535060"
+      "199984223808721679685660672668574010266703101840137966112890158844121346238967055265586337720563"
+      "656945076973896008866961540151608623371400321941111179385796811579140854244865453263553410177645"
+      "878522718843180101522104988830898166680307909922397174994572751645138154146920723566539084456536"
+      "425029443946230331314008122422463051367099273933311113172059726718966311854174867477988713332082"
+      "26992838344653421293924893416433794558513589011611309370041563779286876725823001",
+      "30"
+    },
+    {
+      "170003857441113621055924711218201581479060969973774823543550655221015298985029713903581691625806"
+      "778175064153013683952617568923683195904825491671562597778394848940698100060988046881674679194048"
+      "284424046096930240621809667552628402886187489064670995742803216624905991737595831860741767548013"
+      "712391467620520309900241319253287943675129083092747241525094828376937402590205346662298390862562"
+      "643436019735148452642958172300132516340448730506554851256643796686115524433824609798825320819953"
+      "662000059899761347431172299049404919145053054118348793890650129877368554102264664237",
+      "354"
+    },
+    {
+      "-31826882167847269036795264135997035261326106742393531631262513546951621739538129483912871462979"
+      "086464612269631159787510831358937051013784806855551647371523568233230776308094926266913151377871"
+      "925647720334390123342313810138336493293789276924639127443823386014514502682882716709333886588047"
+      "556737429630427737978891250291212164857441066067952971934975332936367526583068834875982474415309"
+      "122221371543750940258579267452360489050995048217629796997409692793673935051432353130414145045187"
+      "876172429836566644615416398029958336369046123993446514393441794181039041943485420490171529217309",
+      "15755919270"
+    },
+    {
+      "470023752335086806154925750228745182505802165953221881187293885817790572703578909097576609259612"
+      "048650107641573576773396406794198010755293758414058342000758597101515394269857927227651139631987"
+      "730762330387103053323761608332245274551978437543782423306631259023542333183530627992031636037343"
+      "661358260558335452109436639721004220128711197262809721530825527742820153163101076758847415912389"
+      "873295224320701249956855854697941668782306120097132522916159183941992306442021676955225747302957"
+      "64175556463982949470912949002495605091357997599244798045099081157657094553333043809915382015",
+      "5478"
+    },
+    {
+      "-11040743826790404493224576404749065595646740330120180405527616939751966233987012633958431345749"
+      "190631119793349790016898567458017914318448351928803498972172882935130208207618165362923407728954"
+      "132436164579314674396243206195453246793966934264794726704150054916937293016298909108659529286402"
+      "365915934008052581798614292831087826773808537997292525501699755074418416568787798719220098075756"
+      "592789059661642000375611862843358745886690470793196946802804639119233251434998419837436462116298"
+      "13016265241858462427586701167961402272877528256110590588675820001821779929699856406082793746601",
+      "30"
+    },
+    {
+      "830966056816864165219563221691255172504816245427194942775778460297239574008254673723276280782798"
+      "993878568376502765275874049468633347470545478154168815827272595416765071482194437630416545142455"
+      "883532025709379623773918422191234979559992742090527602639659473260751398640580101548381014113971"
+      "979542275363074811349527026580264739170503267212543977947471780118824749687917395812884246155157"
+      "646166836076504356150965742303158590029916282708649948973023160673477590749360021799996465506161"
+      "348017383225242179003450331850903647117458837892565999818223864269663453594385683125383821474811"
+      "083023",
+      "5213334"
+    },
+    {
+      "-18840632174653835864968232583541556084424607654449238363350816356454780409921315489669153042640"
+      "423571904583615446707687427327682018540206290243741793046153140931788677169249364676259458302231"
+      "885326120895149522010431725107071591063425627272025446059167464033814661996655342902404678020463"
+      "898666363623366708637084399729725592271785009331862696316729612579245598615561813162507665448387"
+      "066401343329999818243511962109583265019621658883154231991893552479038765074765515515428784392050"
+      "898556152995633956321371743766583910838111997813677461374152418833832478425757962198139801618258"
+      "600291701",
+      "27030"
+    },
+    {
+      "177948829071244383748461224300047737954439245366393998814954157666837290036442548237545354559654"
+      "248140762601235025124016956688571054331709927511568833209554328300942088687575803158770352778902"
+      "946800416194092364129368960809507136675944946524355529271391513095831833834095214141413201872443"
+      "533465259338559071060276534081662109185490926535115165429017697889522123426359409741271701359896"
+      "235732490827288153220352311977810488328925043422296933754175073177948425972950246944493271200423"
+      "473793223213272148300689418662045121140562185310116950518967585206995379939580805302928813353440"
+      "147414740763",
+      "57822"
+    },
+    {
+      "-61269144493917664631232731022846529813705092483919711268161092758214660969768016693482387103616"
+      "477125781797579794147619924400672329173351640551079207803632629427826334820069999713505912136711"
+      "091223317511220813736883913351946252000991006438432445142463832317438732822582878923363404269407"
+      "367815872306449957040543350039984259454696275456856232005509703245340804040654845352999533863372"
+      "810092715375280013391796446991954048800316467960953725700286241101314876754678423357935221212523"
+      "286127231782649419635501144806157556607901080384244729183268152978615781109704335461548441469963"
+      "83907171442617576638221916277",
+      "446617991732222310"
+    },
+    {
+      "370417641649773203811105792421530317349989434553176611030631322780037740921920903496806496686319"
+      "103807921979015270437429241936687918394087764863038019578527638851481686403847480960464641545840"
+      "936004289242306394237365086284210791291343989458767793541220855587660095196948191905734357956461"
+      "535121861354233393019487098593606068830314737953863466706245485662337370451037774820208643752612"
+      "698330292374600196793018724057118532300846184682702881492970790966220893763118615367891028920559"
+      "173128847556946881708070136133779182213573320504698972245409107308503781210793753700634159761806"
+      "826499289415831",
+      "6"
+    },
+    {
+      "-90030970488905754941270305548795930025069125524363231499535684346940919758659818183631577566569"
+      "520381081722825776780099520883222340604428794413438111752864267955248733312825214213137535912179"
+      "341550821149653783416745278428453641272432906431422340515931028866469882933912807501910930868405"
+      "829000660468284868526991350963159263599106129191084858889684960980143159082309872237663332678336"
+      "264089029481711742800825087844753456807070627506493921174343064414553125137512114090364690256786"
+      "561009403653154219231179868590071328739554921731741066495876080135223436008846850455981380191356"
+      "5013476710034147368107",
+      "3210"
+    },
+    {
+      "540225378036603052990346199510807018158832443697480204250735647980528769665424434313990872758579"
+      "010452107244811015945468601296416203994681028077935333710904631550194393763004260011111100825548"
+      "574063403788483396960128246802587868245758939531860810951947380313150279879015996990630764008503"
+      "734609295336446716698563835417186829599083092840489872534295498661581692604738992833247348405554"
+      "718444514715819066290814050483578753507554646952863979076391383441009893119692913361907939161706"
+      "063270762791744758589293326376202474981797215714041228104976085973923103417416892300182603205767"
+      "38940580419471886026121",
+      "42"
+    },
+    {
+      "-17863183260190853617100455803276109629660355564206933702246665794822461822000046286081930744725"
+      "503842501272304257099063615939316292048926549694588184341522319708903955839904623041272213447056"
+      "418545452654669216892885664400985467889256537888411656349639391150600279180375692537203498404243"
+      "624489047740843454616456444012315957511838273176212054134924390070879239743698307160207828581365"
+      "942506665915636569024245707446222626747837424424339538052675049519121854488886188014302086591652"
+      "005516738315892240048612873997724972623635473846803653266728372008395154343488099259782903356490"
+      "4575040629182418739065389001",
+      "30"
+    },
+    {
+      "791452428000395052990463674367408774641299277169449382275797418384963666743647706199968141726577"
+      "699871535620647877271680371011363641725875016441804003162706216814077280766553803448788712737779"
+      "201122868425785256450531121303233116813021906603098871081632396261587905577208955217566658493203"
+      "885877312418398060846091120975165767009344894679683148265158035296420969642632188332444968324025"
+      "169811975004853721487927435823390089679208323886268818820308870377103259885100640557295098484358"
+      "112295185600733503211183865432570364543715288518332255545140994972346903247999234036372815320143"
+      "622542006284391778075614230370915",
+      "28446"
+    },
+    {
+      "-14750577990707069090892640643627890396790588057597932870361312797605339877218555318290483697927"
+      "533647647152620207786705312787195868985834595937926758107692208298403338603695989231215167692521"
+      "223914659443461688651180043473122600527834618929052569980773595567060954830287077779819370475900"
+      "148020136696922033144977602316267162377565896641961582226753571000379259049438007003714263998786"
+      "954349001656043288757745179230747108219268158244213583535560775121257993743283335146172958812409"
+      "641851314398652207671071800026121000251318559834563893238437683153099891646143428578083417759291"
+      "169439869395337214083816200847999672131739013721",
+      "112409792943630"
+    },
+    {
+      "374777948723013249190078483967036070262196995319721004950125135841911814198619011549356410270085"
+      "469095562024553680419264421054828395920348232957623922946064229211025115849670614254096564246170"
+      "554453262384472539133699367436058609043489926484940433001535924350976694798538284096205775504449"
+      "181934303253795061219432435260009742614505900088509170788373024679338732454965657850652041060078"
+      "316582665978147857775596653790453928593902453563143158355566291115657291683041742729879139219276"
+      "250481332199401859588498140624220600217158361818255902856801921431578477123793591885984116771323"
+      "0012475726056827372638626381963585567",
+      "6"
+    },
+    {
+      "-90024360230387232926513776967323326794697521699014742623495978698606015115117275163938036449925"
+      "194916848722477911818639649193586017040660336424190717814222779195576374240102808595115759449145"
+      "109628358599211511306846046027111627976699604296466038648254628913968475783753631135765609682725"
+      "844055075467512860033319632741902401109514097069147699670253945763189080474357381924555174022637"
+      "039432337932007567967360013189225484557699891500723386807516891972255376800483482791579348941380"
+      "904127063436404359870716285253826928676282091132256974170075250937201408937099856598602948280585"
+      "945432968199829410867368026769199252595801",
+      "30"
+    },
+    {
+      "268255361246337126367778228815259545045868431029437849645589178925638795843497414272945160749514"
+      "714084165426561127725005493039810079480452517290207498185200717509668055892683546318815665341535"
+      "697032808106797631781867079778636900617376382054640817598394038676153517033958597909974830544311"
+      "249490853122270098045783563026899566057862076965478508567587449877041567729076139718636854981066"
+      "664507897053160317558190734639340443419436918626125596334898307900637096349388220502296543130848"
+      "656587202710882968136604232104512201075293126007959863944130551986019010434312311477565523149656"
+      "237135607816533477227160969517648113475415388407",
+      "18438"
+    },
+    {
+      "-19715495615154980459452817077813587252020524188204692102871003751244086350528899585284214622061"
+      "489980403636043149166921083159707663176823601945686976515979399929426086078632404364406705872638"
+      "988259004550091480475956798374617998494653436871385910480449607892403682828980142908790826218589"
+      "612379019283823666710200371893951931734113704220880589401237201138758287974113485818995566859389"
+      "757540809367751356391407473035208862841761173489205172040416753626411623999255765766532917832477"
+      "449875734367104295945920968153138079263522926627628616750652570561155210360770367067264550444012"
+      "25578559120921795944351508096992367201543994966078858397",
+      "27695910"
+    },
+    {
+      "934217844394639862121876161182125782629662966798874841047916685310521671553962326103991809647198"
+      "275117953002131456853984058360472753503867675200497447364861473654065939291320525986944570166180"
+      "778722315422080724702421323386482784126733369118721815203984881266971497573448614086191554625693"
+      "617723971683850141789064565402372607797348631247017594179350444633051496340472506374723019936564"
+      "961282558140233726105870589191017887960191293607258806456016263231512800235871497605920995641449"
+      "875958591869460832774676734017514779283735936104646380107986104389604327378999649850427118391694"
+      "149262577932479289635308490619974233553612397882181813",
+      "2658"
+    },
+    {
+      "-15884513568258363731005041437821459579917453953441303555845792718026065530734393894595077614175"
+      "726152437775578557838979439071340042420495522406428742171421030870594907474492959693263224135868"
+      "826281372617495874832002579718819122430353590887512946558623409262917580059224921110632093539405"
+      "478727276131167150219922452044309887915157388880177162319288352632892712980762279252833579270031"
+      "870568954093329059834770705552249125131464080432069390028121522426230921738743843126866687505908"
+      "361602290573917734353242427969592045269189702823770841024569764278173312430406210407010666920226"
+      "2888345577753573178251769219880004565578924500260455594131928657",
+      "90709710"
+    },
+    {
+      "528209885509128040714518844918737070776113976790847044417861486065523050370503309024768313307636"
+      "182746179481352859499577280286958706885016518553652932142616657630240045555650852028977769229887"
+      "492311638629018181531082647907342532515592291931500381946546168366737012953996398427116108826232"
+      "383858541574771504205296861406357221185275870634782864675061934982893485901402090588484311752574"
+      "650510906065640811404322762111072202575605528360242466263121322238792071710641904217309338297022"
+      "204687461181166875901729773267778072261484736348289645852943225603612238964209547490549065264957"
+      "33099883401725824247665659378641424764700866014787892724263",
+      "6"
+    },
+    {
+      "-33509969560310951077673300385182939173120218233464878294252193880216174489593173505823838246617"
+      "056145585882555706860451887313675357842060706217782059762885287365030658978615168275599290138352"
+      "468354789757259008089648541137547348110439089815672768327313180473534796888815851856313394644427"
+      "062261422524265399511451721069073409293158382781768172256354047772889044225230507510811482737634"
+      "673210381142106400974943160605739571810507050337114409751599167906471400307782233953490003352622"
+      "899793151422802066630790773271959078676470883432223098011999197297967048507289842238199051754189"
+      "231014498571762573655266437187969662451821328060350075608863875769571341",
+      "750400230"
+    },
+    {
+      "939105557276537533708439611731455781771818016618150916127156105912944358939748508151301842470507"
+      "147420617416663908235618145482944407249187787055206269405937884977095844232222346382927098990175"
+      "046814460917151621964890278463871213037256971399875889422640315443736454623704693623448687831344"
+      "474050891290575999649108540631352967440022518847124394585064156865971067040227096943080500189484"
+      "292244044261855801654249436066126886759733117654755483194526394048285540977346778871657194623549"
+      "333136295306513619692533239253726852428181266012068691690755145607171805900490056294012651565563"
+      "8458838017179782433551203385736031994621640626329584486625252298313721425",
+      "41089818"
+    },
+    {
+      "-80367886003297896375549054086064347511517633438276369992393735954581890880122260874430849108699"
+      "364318031062443573127550909621163684824752766942529058158885380840632238599715260765992393585071"
+      "636995085421789432768541505622906828564235089007987771127871856234458707471506151507821724226042"
+      "138437306887214331971939276543072615576255171247642872288414211715126345345853916204013357997654"
+      "583531014637436039830627861311450176556119145347557042759154627656338570661854115739997895354051"
+      "906410549708379824464463142456418392581452461020213035079331667871265081190069841377288126400576"
+      "12823780541560848078401500756860998000273851310662643557278203530509156427",
+      "6810"
+    },
+    {
+      "368876510951903593959786317074508977015521801043266751209196096948205606480304749791711335395378"
+      "622106620447360266215416790083735323006951553131505613624795519044102404320708564462639239792995"
+      "000924445160289688035381048786725398149812361988544504781753910103380003537917513832686730720009"
+      "389442465152773861321405832578561326965585628471618149969760751747696947486954386325750905868249"
+      "912842495426514041322052136702614252272224862643041825606799630387209499955794229337966949860111"
+      "353856773833185425305062417310184762307968084455746993325213661329357449420920637371177199724194"
+      "46305379041821531028902499051591918182645467840089773846410376436748099927",
+      "6"
+    },
+    {
+      "-92312514972053377868052801066270353656142374247301601086049246517369761800757988962152487926542"
+      "259220316909899899368144286166397990045855922485165521052287451156007720904696186499491108648744"
+      "373648708182228984933645850279283745566527687499813609290582982432057944956567237481644037817487"
+      "305790863356387524174312775934732113090770703598960172747890665505524695476989798280772563893895"
+      "897652863851502639463221374357034893227010574133394097159074204010157455592807699978993507559492"
+      "935701948115956175397754323008779481310845004697668037459053318718391181786051206934824835777620"
+      "03279580322707699760471279269534859347690610372106577357727353920929624706796074041823",
+      "285702690"
+    },
+    {
+      "102782563538126102508413750951856496256072845013222353952152694881735363618170265692858382882871"
+      "743994158244987762266970742990693428855227829147151891382457095255323436878972460344283856731814"
+      "144161565525767681218723995255421790894843807617837791022556048911674883988696945333769530978168"
+      "445592814155261158108021694193019296852341689719506376253855740928753998066125689400939240808935"
+      "891549697757662722514885923646850536934200348042836679856933469870621958339639775704742246667453"
+      "719619295226718083754990171049093533730911367689048485760252154477331682127508464792750960273178"
+      "7989854783170081148513873085444058741939360926584684355544622280387129474006982319",
+      "6"
+    },
+    {
+      "-65507601541135099553225195203246897628183453093303193720443439469112063977453165004838124422370"
+      "144389413352939447500879074058495134264366249105421140244069500569194474345240967233524480174462"
+      "973588737102486174212455700152251212621356120279722841979221537183317765329450851696108510884378"
+      "771348780089193419806315312144319917159592995634280813277622844219943337682519217571886569277042"
+      "138721714659255018616038851101990624959298172448640467652403003727820709423068089313532982373291"
+      "931040236485237271350256132728603124857597760978089255617266468746220861206774497387080165950108"
+      "77049123286575216517173385795826972669505322466175106064791167244415577645190187783109558537",
+      "7150110"
+    },
+    {
+      "636888658885589052901557315727024332985747392751005503244802979976675397327773349074380248113124"
+      "968457448051653670739606434140113483168871652781295546864249799561246957096519581716048742198568"
+      "078879341109614035666197614674515022810207552910234037372348299698326576660639014386096667011376"
+      "490283647522704234214085370390269095365373807109861798705233949400843729425874395370913549860209"
+      "060750769369033081150234380435180592172958769468894953076792547254749408568798780541041050596337"
+      "349948178559086155130464375195792963986390645158304544898842071296943008336891954855490348967390"
+      "487729574523008025409811403139504028037864592122790238965967453566193132825920147268471352205543"
+      "3",
+      "1288550298"
+    },
+    {
+      "-18857298830179974924112770561541616281221221384189502076669076264976047092808327044455285057264"
+      "395611449721575261104778730410937517584780569515178453218485162032064757985570592549670176144846"
+      "580835479581397377968080888816781876496470092553884213405439099295600166922552094277862936626130"
+      "926947208594986670564424305882222906991140105027483580040316310589718891869241651684068673823444"
+      "617158761420516419921212830316201380950669071896202429509916122408216700391529207614337322294413"
+      "686616755640417010114017871014732687567523349487169987728627933665583187730293169187072702919606"
+      "093787317858957503395390909796261383238052409749871941799053230411409317203638562750384668947688"
+      "7699",
+      "7010970"
+    },
+    {
+      "413664867987222956244209355804553132010737311619873937552617773013514076367023256312176160835062"
+      "661892330568050774492900833764272232882273128949537336490168744752502048943049241434525025420643"
+      "944559491826884487174091266835019079457750298308269731643882842579624683236689298288625957015934"
+      "020852065186333120537819299541510992711232749590370342660947186143661434743740645683801183663840"
+      "994358198551336011498396150912151423938206307866725487635171065947029616755552973030152102744795"
+      "495331947296938243287814790516243968203740094323906300807997945263580249967044922095488324059855"
+      "868304323339162224087731767838889133184638682384777584272685488996638922752221799803151101166568"
+      "141",
+      "2802"
+    },
+    {
+      "-10311078417158292583434639119120306980330115269372483557430566896746976027235401129901729566485"
+      "900630311432606007240043470650279475071004884505933907055950965373842725501345625808090366893466"
+      "647209730193061076367422321655032236938841399863742043699815440776568111639881494792583698952007"
+      "463596848032541544011246226784913225879401662536883634517612792101458129355569590056170963578841"
+      "549043151692170405579892517520980162628979902260722259369702927489002804694624192390688298028498"
+      "146165252739471602566624583122435076121844815863726937122267329555711487461642239402906465097059"
+      "848815484229929916442556184583129315171729728249556091038638700500048303589821531561282153289216"
+      "78827090764016307",
+      "1261596819210"
+    },
+    {
+      "301188512670574409973522039731799774332284237966284386701245748565406164428681036128926063056095"
+      "855532173991462477799681429260898037617758622985941710976235577943559100259786932475830383970536"
+      "995316845412258295246742979426181833225367398491810295210078233611825547244385629725708901995508"
+      "766557190851612705431746456650510895626334976810141560416672624945285953742157497174172068239724"
+      "208754377218814505115022247180573164262593883452362474468782982223281207823275802362572430210812"
+      "017251300349771480681113489830696638136842926883664618708287688430079713258060558978096084995295"
+      "625323965331459365135957743350303225791768643943305879602716567061428469743627314569410061103860"
+      "282955485",
+      "66"
+    },
+    {
+      "-77093700457084754271091665056593178961245023585985406136416469901220305663891805513525989541610"
+      "727342694879750023289720385307179039388511646517139387597667369338500087933719821355644779439843"
+      "478235265473856312202262464296786457145438381426764887604844959060348011569368916258075599268611"
+      "653456366381620350652096950095474135368308169187117084157285393268445701919072745257938826951876"
+      "107006601222563790676659880888913476690687085717049106972752285498760411014020216570102805631771"
+      "554675548288828114197906420616111989321355744112468269784405866286783731771856807463267213940477"
+      "585067380136750345013434162873762750805827533103135524687571009218889458146221275327551386516497"
+      "6897399277601",
+      "30"
+    },
+    {
+      "612952292169890392422509409889449397535534249520258396707026864996049152742542554628612899465235"
+      "974779561457672930090119328846836409835192142589860586599073773776319685962393963038203188490802"
+      "762813787704449077187462862978005733804889649294757796800751981500316824639564346558434304319323"
+      "788088163599841936858527382357472083749625528260149699708880312630557525481420723948112481931077"
+      "760185178000800453453098222545233027736231153217461521968565187309136079630980890093898079984304"
+      "519772412420545970369240469281520685695961466749815643985486037860603959658552943868977788562886"
+      "216218700863119242145030707168058572872807257258094778023952047027577963159032879813628320965362"
+      "3721740978652009",
+      "42"
+    },
+    {
+      "-17379423342300736405717844177647822047732929524799274624619402803309895539459843486368861521991"
+      "621432430102300109335789374633008390374420499116665081206184142374648758717528679082279957824121"
+      "275749931210032364789980185681658781469425053516060865121420317871519433082960219631929983049825"
+      "548102480965351668164793837106964205698945323849219489946453419457598425921177877747472682590727"
+      "634267960794359502992576497468612049383075085881514411101815663974886306567994459430027969032029"
+      "548101477476877007773405036794285689450791457171129992776268303501110154708108211346384015043987"
+      "844050506209590781786045225343460048504352183298203921719278001720504314354281288726705421796894"
+      "4656636429743815938366731",
+      "207930"
+    },
+    {
+      "138736748329237451706365474934079747788120317871624843969222035842450993638752664103925792499776"
+      "549015462261382557256828901651664455343262119677887709650506063356203296293922665090066676360603"
+      "460808284039809008707284728447012008490510310327211103838969929939606007204472641770113794896969"
+      "220126392340549450464935158306469160755287789958752638917244223242248711043212927798168660478695"
+      "941988170755018313199077763545432669245662313406177262102697135053362285890026493828211528767698"
+      "867962376250649399315970878982263876605072991393852521123682413378659820794625867056567584492629"
+      "799061524097031158114255355047037829351791497216828872288610052669325951498101840202725441380338"
+      "41220106232249961984874041",
+      "2874"
+    },
+    {
+      "-26012984231082938122321205711106137025736836308811099420978321017146930273005671218213801512995"
+      "150233049010223325808387207760652312185884489040204754381130425223206104908949348483694397053700"
+      "779323806598166397483624967026385155584314813089275200872985931085543928822164664368156111249818"
+      "285706698582816847860316768251385568355911376789419906820360322920270272727732554866797105317523"
+      "759568495736021299387762599572352567156747373223964524139683333489545030164669822955224449969772"
+      "265055374313158826483073058617899550929715104043848380098396583498089878468223019258239295983312"
+      "553586622706514962679548326500707178484227310027019877548445744372693423428185302230083093969160"
+      "616600533454208539007576331211435405256579",
+      "925269860885370"
+    },
+    {
+      "990616118004405209547336756803741296643221987382321931721822820900299097210222317336001831102939"
+      "236490395767769383589450743538317573906480157831910388399026009549363482047723522295682385225255"
+      "084608513720106406633464966275709378145660935302980557499077874664887504148114522460257788204486"
+      "783699727500508138689641080038916313291730518751063292404119140988768624151887967557709255327422"
+      "581104429283482510069570158085040668138860662778558327704232203358594262804010229103345601462990"
+      "376149249652299540260177492690219461257167020609270211173637016502365724336529333125021542322561"
+      "542486553234490872949324335738034611680591470710376104053043734142034650737431499785882884589522"
+      "913671849942865299633710178111",
+      "6"
+    },
+    {
+      "-67458392197424380672758362660572689330500126334347027784764414135371128371914474839621464346481"
+      "552772005117663683783064120271503191255854575127226596345915883267871177757443672510988304868805"
+      "437789240803024768655639895225247137834202574101143857509948489634133677105394616859611760377943"
+      "300958348608777826109273310209536257529491481525772329941355298742893062544134997648318206356579"
+      "338440826646538047452952053482611495404763075487866804073584961078870988082054198925090633480011"
+      "938601417622164022045442694164420267062459959499741675751425457093003126486309295280353197386087"
+      "993003289902934257812485432538519956276512152610321358835931236882845368841797213350475752370488"
+      "8418645741605357575301183566273541023",
+      "690"
+    },
+    {
+      "369763997577304898527792056092078784633064579850215089906718927953975408532819407204558577594984"
+      "146089620623998022051043813802512840569387856574528038951679028036813020229062675066916989178254"
+      "799161955591299056486170972788431152654760791766791190599466061280142672740585701636947897534361"
+      "260451582259758691868004875864277790983654375073056163053627813804545640618169241729192679530964"
+      "042280652574338325670662894789508966565337142721844903092886592945025900894162911247219665577745"
+      "221033424450158824779569415157792860757313903143859765449917326253963605938268777389669269349544"
+      "451932422774330893531316131993509969738757701435869993709233337662014445697606454995935095546520"
+      "785205839498933104702647973917548450654482159",
+      "63346038"
+    },
+    {
+      "-10541816873814096381316169108539113544559806579137816926164708551453053764421674476779663590418"
+      "587721548805288914617597594086705240368673303934588475540778050221133715515127613013536686418819"
+      "433156406738624119864020847059082718330372484411485597582033736496792901481620093071040857138614"
+      "374070277702490846650695664248028186959784027234555083365255720079247979950886689963934128030067"
+      "369716278895226180485362879082526221980577215262396385617524132279613757092621411332044486165677"
+      "804146252629352839983467564429582144636634184191363198151813999632307770474159980792200412996991"
+      "870674127149512046516569338215208475275772897223820007540638044339880428153723968600215159459367"
+      "88059415457004917777955610189853432234056001",
+      "30"
+    },
+    {
+      "490708060345718168482949551065008296976352341812156850912460754793773228598743021163789697895339"
+      "848508047563198613297970895771272423084451586762411542433689884882582217920150615320261296412657"
+      "655420294950882472519077107436411891314989684272827405143453664676299901282427746214002776016429"
+      "289992734596941647026794542862610180682813869753438462413802302318288921935542654412271101075502"
+      "309306996459972517715826132089736597584320511669263794701105417099176436055541622722611853665479"
+      "429929243382275785136760788118477444370781356616739167758192241507716005871662971992278037186350"
+      "173271291067722673038829083878521474773044108789762491726385320922397469619970046438378452390321"
+      "367551511627206765616414040686450916033159995734945",
+      "2300826"
+    },
+    {
+      "-29571068203636866046288982859461223295592495500220152470524852020659222298589820846856440902464"
+      "355266331921730127927945659951516772762515060645001891839736586682662551000383780776223472190722"
+      "926893972826075320957895148583235837966175332090509693705495409824532828283882061200292799982787"
+      "533794336758250202054566895650111341100127955540207905539288764843239635727038706673051411859354"
+      "656143960391977874255951201590147514647612314156424329132790942850522708114929089738480080979772"
+      "959408130779591112576103406337356037191034111930714511879376223307462677590891465762187531182727"
+      "331935416048942500997565555024227597619955118636192752511984670039590742279929660651924836984103"
+      "0425783198567324724905036753320437659605858401058641353",
+      "226590"
+    },
+    {
+      "483049520560700249858177567882399789086824383553406567918229500625907963552412466894489636117289"
+      "385056013694632157195762896070359698773642254744021501072670210334726176330024986667395407197260"
+      "672089084008686294716524294580787684846264392838844795172809782471928593994008782969148055489295"
+      "860549520545509416900467263873853432524745078962055365592853439992861256734658389110188036769686"
+      "342340589961430764533190073583476950977696482241431914136512209884110123657419726451364709052407"
+      "477762252236017014987041031403626598657560585240367052731808496000172034226362765220595663439733"
+      "476783625903396579749288087861502113858006100123874110131952296752950967858334783924239580399180"
+      "96194458403331849842918089944679987935690252652536647",
+      "6"
+    },
+    {
+      "-25535109222241698972694173193973518774716242178265877234279078154218306288190453574391345349607"
+      "020347701104389306082727640662249328994752154372973422361999092715922759633521270378541507790769"
+      "763357456276378726595626459724623679603915577643947700472106673593583118436960062894166402312867"
+      "190376592931480464022802240967436286930003098509086131781553808335933575272888361402715107788113"
+      "154287996385861486207257531899222760762747086758473894396360217594584387656887231071811145643960"
+      "111628458232775253525983817907496407600357182919744162523813712195436135703038816616947504736640"
+      "465073624938220282345566631808140813969037396579578863663701714202683178828730441933582773514024"
+      "218332915875259194767588507001149870106803558286434937883617",
+      "510"
+    },
+    {
+      "109865122848151584611673560594290165754441894276368560548381912845497638546489943473724236724095"
+      "238506744474900836564256806367057972840967346175127292454912528560279504541320374184423042635861"
+      "675985398329422741182189709234833344612099575633961637349062044653629889016751770974632874287029"
+      "915736629535639003257698478643655378973595019757875361471141167104505491430542529353951978597591"
+      "329218845843547284003410332653298426772099783819705741178585242260541458732945989862623831443160"
+      "498317466595792069381575522773601354592978160307298563892368832435529933879136847223915909126311"
+      "223045236240031443275276664068708400030822980635517221018152497164494285989399694041087509194064"
+      "9202106109066788663807627887433701124817799811432100659519242101309",
+      "3499986"
+    },
+    {
+      "-16596380640568557229852123088077134206658664302806671892352650993155331641220960084014956088135"
+      "770921465025323942809207851857992860213463783252745409096420932509953165466735675485979034817619"
+      "983727209844291081908145597829674980159889976244240633746601120703300698329029710482600069717866"
+      "917229113749797632930033559794717838407415772796504419464932337498642714226081743688706971990010"
+      "734262076881238322867559275748219588404488023034528296023051638858467185173202483888794342720837"
+      "413737644410765563213220043477396887812891242952336301344808165757942109887803692579439427973561"
+      "487863524556256869403384306433922049078300720480361757680714198044230522015775475287075315668886"
+      "299978958150756677417180004362981454396613646612327019784141740499835461",
+      "8365830"
+    },
+    {
+      "381421608664672328845543092240346516340931381205624082299372843352624625821500757962198595520521"
+      "720316210403043956391164900069215434786556671549407395563775036241203542775443967628108879629423"
+      "823252684069175406391010806697247644958141872978060625152073182496722952917663297239218263778565"
+      "156146246159564405157677350381662138593592582605967871816384718602359000180417988492342645684125"
+      "372900392386161666896495551782426435051757308452346847184917590302649189612782289332774282173225"
+      "614076327230296507200234714323104165635506657176417187629975689901683913793483285883050181469780"
+      "380358139103043234567443260564212276449202165561617100457949090056823632087546004865908897882502"
+      "60509713591684353378394987140492585724853790406456014075678089228508113",
+      "3018"
+    },
+    {
+      "-18006771329450391668304631775077545852663795038269911510929660340315764491338785871425964653052"
+      "420731601441525599618980770780975011651639266886215325620537863323130515817641693575535226528741"
+      "877926923964021301497628069879932771390843910320300463780449982496620990927141275752380515870287"
+      "141747017553840046166316023751275547823847473159332045893490291471495169325151076359480950981646"
+      "102109135362080415444504201005277044197513713235727007246310613641767307855133731022922493694454"
+      "933189343142342245689355473055506568139356450019390353280539775469931648165060352085037208629652"
+      "944634013765139717250708458477556102665436491892474395884356783297346167744480104773212322089478"
+      "99575788038500962386042680131078463676696610992661373557922895517318715229936758650701",
+      "22187634681030"
+    },
+    {
+      "340709266400088802120345253132185409750557477178001032314011524363932969576064150121689027468760"
+      "291540350033088128671822652497356627945680040099513402366376630418955273249511312740296674093758"
+      "504637830809711869646714541706476783773351056444957643674609304891231205614937455184753846785498"
+      "530622168903106787212787556350159388785620880631669513559487753144782400316709603606561757570505"
+      "655738402214846062751569020838680770410392392192721819158200231770574968227771397208560996179734"
+      "578149042473854354834407119752423626418871780647257855224618374381409606893201476197231703394195"
+      "967011439611423450093139388290995233277497528573381748864174347416214967589659791380333162253512"
+      "7687151459453007625739740586548355715148750010148880114637554413024765424290583",
+      "6486"
+    },
+    {
+      "-52330872178864919159062934248811034677716346435451171579625680157504590875649650612604071777425"
+      "057835576694786058730875910671528004523387504518166814277738052868766866355057576748290359718969"
+      "833452822491290378051432150449875893578677161725044098600023286511690481099580507383765244539884"
+      "609683069965610545535720187021317978962117739273816300866637103926903577096852506972785978366778"
+      "165411897640281470897335963093004160986149712861282324545139248731784241707150208210973241489236"
+      "159298771028866236477155299508578436092419084781731382688534659597130973002574127128838580705882"
+      "780124058350777061662396371643479550445807460673182703996222427053489945756261651236145314233440"
+      "795152480496528484684484783377509237409326975075232834132368554805879249824492525509",
+      "15270"
+    },
+    {
+      "332420693949363478414164527366994734270241721388456820192565765841197658711903129266061006566379"
+      "082144239695694846518705844544992415077449569407788953915391070837640185929972714379661241689062"
+      "944685330295283663369639489503742389501074883060605665901267498538668548304538452585558550477856"
+      "576806035179547745814679447301970518594767371550177278893379477070742000027106534240294853153729"
+      "533565630892527050658093610308083430821437056109189493196771291429050967588156021116888950684345"
+      "637000797750557646121713517261421608014873014737520283481093820501406502024536372150033465837292"
+      "529110261926749082352700033519567410378372987620127023173838873457125568916689903177182173923366"
+      "74707264997388324092541227765928407061361719176124984332381749616812108779909330327830755",
+      "1475166"
+    },
+    {
+      "-19574090030244434047213351246572287349889224090386105332085530021565212468309629078867733735082"
+      "393179869360807348367069978848976650308351642234932679401041693373523083884636419791481410049596"
+      "925094734909075722364890598079520710349410498082492443132331727391159087801199795999981412721502"
+      "899511443450789947024862600168168142673409305962634689502298433085733432678101898354175041732136"
+      "336805601649931124766200234393846083129971259028671079883947611022235924234367655079017649320478"
+      "568127235277626555274100732608797872995058244863960865024164628482909246406276310802734955042229"
+      "966804956539569782508945050791832760086043325797818433262717417889163900766948683071025772992337"
+      "715877718869786571877810172471257113404842472203190786613590614226393093167710566161135264769",
+      "131070"
+    },
+    {
+      "598480879359201907125163770563923701266503475146823811163033537760978572333607098237828641802422"
+      "568128162641022551506522839790215028962181225081005006671377313730529756188134992525981459221835"
+      "869328406492413817955053764371317354907924051284765204436219802148169693513726291285575167597120"
+      "604869943062137770433592994685888659952552276741279654459431249389573043267211778995061343305122"
+      "476888434581940153542602509483273269335278754951764724843364289379907251324282579310966129614204"
+      "109641899286164702207129058753906627081485182104384723293581071351067107732419338522473215843265"
+      "458917882274008696851239937726804034908125711540652944600729029331297694301586141830712777129066"
+      "4470891625392551366150283915791140376237220432528560560396842964137537614815594687897259007",
+      "6"
+    },
+    {
+      "-31710637541306620245244182089621670678390456651486732686889197882011221379935831709718083646620"
+      "742742326666420531334160926897926042115486227612481644347050903697097120643257337529847919929951"
+      "662956099100207112395530797906547185214383466628737160459340932641272402482869773729964842677362"
+      "592650084388159989849933365993166632700120231250129252148517906553518081720006727498388406935096"
+      "552632666014010375283018964016502399143328040149382515997838090893616083413780842869209839430976"
+      "363108601637738707399803912098238844375604484344402006117991738715571053688279629792866687222716"
+      "369122679609318551697722975972920437595620733640010535921294430378215774385190926038913568399044"
+      "446242149333777033084488778872659781353875940804212896640784871701092438541045771687887775272051"
+      "95143",
+      "472290"
+    },
+    {
+      "273280120135903400796020253856496684011788906317364748953085333993961201260103100240458401853886"
+      "188153815729448551782636694969615369921631309790968386191316441784908017981662481469984984167042"
+      "448669367248157448891503875887451536439734237831153280451449416018604604766043854195342721279546"
+      "881034771821254740522985524013298494222843478038262936400568637590829723962229916157673134572264"
+      "808025853029183736196477170743136876861347086019061648771011440314259278873592910071332879887012"
+      "089047348037711009115437776321582669271597906200622918591149153504310087714501499195741647501615"
+      "811271701261514080038678771942746736185575324689976357305256911162281729889368248612935815145764"
+      "264376288803018064102298711008322925121890227372020995066241641153616485840062558888315856481206"
+      "999",
+      "6"
+    },
+    {
+      "-15238788428605039378115047740536176804744567206667015273138665811936692401854938405838569364075"
+      "998824220469141187088855638530878988136135319459512241969322936054349829360703375345376810354436"
+      "271719677891043872577529784018194689598522436288937138335018202318283345082383679491434519114921"
+      "168761309340363181574377119858546985793819404059166287930359067460156279862548079893608415891765"
+      "800532767931587051491191292999534306031712249512782532969062501087104696613607997651856092534274"
+      "938155634110698340371323359964245551053589097908706914112812993613987014493133848964717508266531"
+      "939188324895544881815213543990830716909231300022370961250882369322358639313176875466799030845939"
+      "901373969474799475354197376777647985632239823850663381353339891722507727003481892612429872120342"
+      "512898069057384453",
+      "48942109590"
+    },
+    {
+      "528168912837706058300773133313257899555587106960109572593099169926084645995536010041644416988320"
+      "274543220347636616930207795735994723115545688498750717900197870506209028410072401487019057548087"
+      "850004588603237730873479814196999295434481931067137764962841073981130954808986206858338403526750"
+      "137235752365371892579241900939848497390232913786112764562239393544911287045142382805501061932343"
+      "506473618683674168767747900246746802225282791577347013789895615636911178307059294962181699407219"
+      "318519240153753487204293936512283759053901619389659472572185496583826983207282984988346521327304"
+      "395017402266395763345017804333827977452165925639660467113974301921652217724840017951255406027050"
+      "071265186378064907895724958299537186189487155190204093627151219088398450682428094579614622538730"
+      "37690356310131011",
+      "24623886"
+    },
+    {
+      "-11748068936121144731316616625146800969962362045403300021610798904081790354720160484984286900632"
+      "635098266677550839935349915920337450028588802844766518113010824112617216726598637306469133053055"
+      "302454576547611071289456116972907204809867380322924291048238685697095656883004016388109899126951"
+      "228129612441773427255202257668778635696260907221283689666977801501624577835501338088841927786182"
+      "700362106264416196880251446853374416795036653846331686981293165847586785665507235004948758728939"
+      "047313031803955034765917873448150164862139679850161354656327227270482915977768021412483377856152"
+      "556766212038665977998186692530495914229023368749666829760208494061894332004985009471625632979760"
+      "443961120035700605223548300044785039363526042988534338187276601844787856099598924412820564981355"
+      "8581691382994627263",
+      "7890"
+    },
+    {
+      "624922331312776473211378904153389829248973306126285038561741107081420976896525537385643705333526"
+      "763797786358447120246174604555658992998043496072157747024812232350202780442603988225504946101054"
+      "051661947279251877978889787914507425007059014379105059050080892493923329971127871558484129692266"
+      "997214231422939497821275958312524972071295653314997165691359417693165165197558722682436343466845"
+      "938272292369295435336576723143069179064001414719858458622191463865616166613658973530269861409308"
+      "522003562719626332284828056988947988712694494533014209801757219138142932589205687989733073245175"
+      "370157778846928499077678366695372554280745592938157075898431595570739719329594212273234574957664"
+      "704878574178987844560659396962992842215167838977644596061384309307907333496206835233208684597271"
+      "417843187595652103",
+      "6"
+    },
+    {
+      "-46726559909548397271827893316847552378342855074239633368841477995191754362737322549558798191422"
+      "418954938602877982320145756110828989027548323413219731486259668407918764403136705806073828946228"
+      "295038430257138387018911742669392681326467197058176445604703401538319336368521293361254097559166"
+      "933655509318284879931210820156579553715284394735484340024667179139523350440243969944935753200396"
+      "132338839901211049635856599563754877232005949961472371078275476853635063918211017730220473007818"
+      "453873066170236448558534251400334283386076837292460634787825115348245934365166447876894700724089"
+      "430754057136089706572855309302115555140944233021760244755985337781841932771267761589788954768996"
+      "041486949045982920297493886906606519315515231498515607838937790106031995774604806079221774030150"
+      "50448976145877354014922894271503",
+      "6365085090"
+    },
+    {
+      "368179084130108033985095887328772696251377269060836502878175175301074705006952853494721233805143"
+      "659350788394383444664008485153297564060325151646939468791046065462025379099581934013897637189594"
+      "098170444121512102085595038700210184656082324519543028478730870472059928224353110403475749162068"
+      "959308964853515745542582119886368262939148932714883454159125405981018559182736663479140641055804"
+      "518239895993418767368306643900420351631266548924767514562022254236289164587974865734391717022367"
+      "795878013190764360894244662434885566840221793231042823772340099709944456078570118483053453444707"
+      "288476096697674938882515957551524981855254836742129146265030746589093408656567015365969358668587"
+      "998403808327747308723752222503260177951681309048905039705538016320583186379669155982843814407952"
+      "84308145231580399576973574855",
+      "7062"
+    },
+    {
+      "-32456155026455675360769905111180654622508404843762530841247660453239800770668973012867664180175"
+      "163984858456776032922618591751896662991039519464608583859082132273770709610634041625641467598288"
+      "952475313266353385501831211835207085524953724544644532820179539688619760497628286736719168248207"
+      "139942843410731126177177620301665071512430494461836373239009273797313871491581599808076123462671"
+      "306548360928341916252282132924203215535378621665023296439299234488278952881221480832478979891246"
+      "496808283914007023125300000123955751041426956064851910536565906869167100057739455234685986507613"
+      "545939322527274811378866649653003975155189636356612880949696578635081530573335812504038257688874"
+      "621239224100548372996586676217328068475714642391572425539761785774784367839748175278335122646185"
+      "615511073543896904071545643689429",
+      "870"
+    },
+    {
+      "202203592443382318805493733238894041423136824600003157248712707564793722249523940924419917319731"
+      "730383593570903893201127791676225930335459563937215152097599122321983040851370111279627098644402"
+      "158190225656085625295349615010489195534632483838741084857103115027840582413386981156988744758415"
+      "055893392249827024037568148379395457320404504126018425351178463800777553966630150034613112995987"
+      "777353564710814875733376572097641228552032736992945229885088791737751411560814720081923912155718"
+      "532621177668979878992376851424372755618550085316884348396033638395827859085335185613385011867238"
+      "484031659818533192169865655878878112318023070345857944160710106171517242269099600914661055180897"
+      "701703238671431131787812097840704258951650381849635801326365198771343166373819354642130543558651"
+      "8335365531551312509697969065357260851",
+      "7518"
+    },
+    {
+      "-15765905371031816991016168745985921399465223598953169464857737857167065352327697327892848826222"
+      "444689835763985871829060261843423642779073760519271344765936992199892222732330969593488352729514"
+      "888675684087463396334653356058140817941385320583123214358305279797745913780309211345103002802683"
+      "684358327894348857436840475494249145132191715265518749110724432648585465791414764261715503653007"
+      "585904095941848649857764097368186961136590573813312638808625873101145107303397935713485505108730"
+      "968874984914732495519801963889006601334821370651061926648784332201054179719104091690089363328503"
+      "566416438330985529437752445281733695496666751699226768372872862817335217209326347261257508684687"
+      "769055003164001753794911071344684335674790233909371175753451937237660541847973151979396416384385"
+      "140903041826399574392074661696204780295469",
+      "8070"
+    },
+    {
+      "857814643848300338009200992785326947766440616020465618611429950623955603331870073455542875289527"
+      "556922804400078825525519606179834120259780530637463776262744956736350409688523399650178454699473"
+      "237398234806711307081762225735691152727420532856014518131792862950363916722783399523099634936109"
+      "162413927817936989852426039776480353369014079837119483810108128211085406552578536707936891138893"
+      "207940711857696139909631969397860514092227059537195734398015529218003944733846659421323316041728"
+      "974502265144509723143688639569724834176265764972257689056721091943803953193411813144548463504621"
+      "632052788487689667014304939696216674847606560736732061368105332720802932462966287281039399925051"
+      "032167108872427167948459478953382929388783279364598308516476683805367037721732143946408452936025"
+      "28467252571710530587103307343085568380559",
+      "6"
+    },
+    {
+      "-12171351609243598146631088080985321595410760217930796403637441217548561659496768565425899392102"
+      "260935071065297940048299063791797225962328790917181672783341224767509482269026218667327294712840"
+      "945355622359123603940204695669253755345808151066406578718609964731286873393068504144451317925298"
+      "631227284899392887131171548186226665413539605492197008355839131648537673126698226747732577116410"
+      "021376468656522074560317117491683373719072710206033579095031803281234863070273013055696980678785"
+      "319755776714505696596252672773784016581730948548106095646904438644744398006675783628732869093543"
+      "033593688634341858070832257680608312802225649261445854510121988008553172137446540352097812849340"
+      "552022425879982042563503883542339132103346721332386992885521224501387626282095562546007302026827"
+      "084498790745776150005311172070377227975782150829619623449640152487",
+      "115471236091149548610"
+    },
+    {
+      "469735149656321636903960185893921040596763993145508011382725153971536194479728786725431953740731"
+      "937301649823776071317727813857007714907016790236795683658992834208704115160500231951703273969035"
+      "330771734377816916876961930271053226483015850463595486869477126937192370524363970905677517189990"
+      "791413883125879905099198194915182530611687738243906219069404887789829283921926628847250215997689"
+      "445455228753722044074797536801543329633638778713725527432417703187493798442203137075342335291518"
+      "619467769812574534629325090275993904472937629313749384178979049772410218802327607976602653058761"
+      "429538465252381510483054205414623724531825784463702760481182966380851570485405453052189350488825"
+      "334763825105660690602734314863991468624280874171759666370838952386938986185990604990952084429944"
+      "7669484168665761423650431175604890691800389004391",
+      "6"
+    },
+    {
+      "-40929038702347377524883526064712986197075804201190166105649974640602821612698283419848775247101"
+      "410664917679424009861785738940093095360852562622169438403734396470271911875229820902730744080407"
+      "098837251006304526632865372548983270618987189879165797365361801901468295968809682823135259651416"
+      "959582692830985698185074577452764281958455596018165627346521827492576621279344964812348720405689"
+      "985951771192427744576748505201525745305744453668340943601008567249615433284946274336528278240831"
+      "169180720740607959766473973659012761091400333286396130979444541640532268257841499708552799242356"
+      "001691550143765358018439568433213135411055048686469519662404960453297799619580386796980752240977"
+      "204904041536717056361971715749341981934458519388952528789319810804864941688343765971895876070856"
+      "2501685944958930128768621210729203638757125376903167632329",
+      "69870"
+    },
+    {
+      "344589764393589391335534826543323759824438183655539745711466407067057006584244413227867584582250"
+      "231115659070772965174543160707843665500005378361324680634069646270818460321199753257940187433198"
+      "502850448712588579195163094786907804977277550793628908645262356044096911425548219102925792564414"
+      "105367440976797283010375585024048888000047152522371537226958866252766322649956789612007408284346"
+      "285337180323769486215343205289664805921787949963140965007021002318137436421951630340722780169920"
+      "386385471294924524193219225273977636179869535688421042687654732137855093658708485836590852448349"
+      "121836864319468615933096536747196351862087602323768566073142098691411878720367186361051216777625"
+      "305790494955626101885756298079163459769143197967453738080857971957577533865960342616164691858570"
+      "0163883740291345524983531838815070138776450866906420237295560119",
+      "78042678"
+    },
+    {
+      "-10057721652543862907389496468574329907482184435101302015719486039156334756782622213411394638896"
+      "047545208471597437358688322270250435446485993348183601688629696413203609360509115136881729592114"
+      "766492884963564454326057145160963345836969078000700716483265641995485536911383365150791476009403"
+      "046858133168450623098887441427375663030348914150853962507911136675756817597623849253244012376477"
+      "389339020724309259621296518506009819517180413228489419137463219655376390995507318403823578598618"
+      "301809556621008692289488206821586124887094994405674191903779855167061252872037642332161277840582"
+      "214617596287061552028157366732169264079134601106360756818860832735080246025233720611664119846884"
+      "174710459149216142286898946338153987252272413548517049105529078237919081828159991557972850907149"
+      "623451558165674602459470229143931492203265278088277283294483001",
+      "30"
+    },
+    {
+      "389247136552178203223764022973797742321049133158248341791869183070549281748220529133168809869769"
+      "313036565626444591886840439338085515376108236592266267689634926037051030555346433252425152994905"
+      "885224375332497074215375975762723447949761135683016991031753935924053725251088595180672794058646"
+      "640630260769511704036209840224617694138797843092621719133350908232645963288694029334531270462092"
+      "810615547882979017423464403537591101879715019650937948154651183398620957808525168799281521042932"
+      "861652489140770738958357046483253855351948867730806972150945608894339072052176945931908466375606"
+      "008247141172492149950990778518784490076722189870087078313969524683794030454607673550835608268160"
+      "833792268525194930579184028595635951100115909351358827859041048673043841574860418241320803832185"
+      "3489746458643971788600052919596530988245088868714017818659968470075",
+      "1518"
+    },
+    {
+      "-97597719297712954419297065072476484857650613432550406209463790187576752054930212409307609378910"
+      "541079190304643495954121999353772151261549948190393378660557118540484536692953548056923362073761"
+      "926530937196186608073257991632349725226823248865884355977485743967024941439805795678137893624201"
+      "567622026057726239663831253419458506817657710425103938784469702409754991214522748621180918527981"
+      "799543971819965570183266204766346031779684819319620044149412521558990093233832972765056517676362"
+      "698434056534469834873485585160042427007536530214733810647205890920571873320040086954443739958192"
+      "451881490196299605517925544332501703902969279708025973968512765020128841136035735702319987171302"
+      "081424963136852024771100787585869194001866466960279752691662854130060793691348367161180080171354"
+      "594583561921113739576805669709547717448994546491959442145090731089412565670931",
+      "4940319930"
+    },
+    {
+      "919837274385564027108565804168805091879316978599242889907304637320299689877933321046930079211451"
+      "569937589987795952943086943729605812867340752730202735145642157546758460115114580238782460597691"
+      "880138858556875841569424962824745542414759852566985562912734749045106643099685895960056459267158"
+      "137629157553840131662199201100001363654265148800047409464167938369568934612206186111290512337982"
+      "038182481478102520055673865423358394279934388121652755235623456785704645178321997100452371325527"
+      "893907356067815190333955704851395804521190238279144814666423533134090014633209022724585156981635"
+      "894351670764122832311070831774284690372533616445660310351023913044219520966996362909438553835176"
+      "008798327143054692110041392886286623054663775742929101832318179516524224917879469521062407835632"
+      "599593048476814887660233310505932812251166021252402118918189575083711727",
+      "6"
+    },
+    {
+      "-20023695941767234604809302513321574301543637835426463870006382105766480730314902540436699796895"
+      "722585664700684896640067283214487879223430747101566088611348587408410963954704064350857240706219"
+      "686103219067078230585092154932814251612979457960796494940845849173878702149203851057439649964566"
+      "504390475710852759682526940192491333472279476292082596230613334327194567271392405484411227828237"
+      "736648563841730637001292391399823767835054767501899270965093286050599823810897127318257706601313"
+      "386232400671377751827635601017102041865262675835738943383134098935878014171312186729805713920621"
+      "846910524108297958126616434160643630363946618755382308119647886431848799752368662596666036311637"
+      "284763098902480881460323176028237438713811390572624063256394458014194955847673780602728634247307"
+      "733814803964928023113761478241998304666178648519679133216787444267139410390691157",
+      "16710"
+    },
+    {
+      "752835934568102793554370445260143910880611601097157915554696373512184667913465638603446719962471"
+      "806977319307424833236544349238863409988369187424824865057348415853937415228651087371710945701776"
+      "553092016213764637713208194262769482670321055499087948216122584850796780678934924323562262299290"
+      "446192476033130796967754491611823292435281568992868372478589118741120900241096717768616354293163"
+      "065762904202849428294379302226296102136567001563890539140883796432076118528315455678689868542715"
+      "752983943862142881515977968367093028991894291921939379956517231179427753634867847875992514189854"
+      "149416828769354258042989744376252297138718192892837699638187240636173154902857937294609158235885"
+      "042525009237941250801413284864682244062242310922261103890939458206297801592003642621368866774595"
+      "6530676072788505332508965977288825720507482857057525319526472592451371566512425827",
+      "798"
+    },
+    {
+      "-11249296807382368471177473815322430694874470915832756091274075220226092518320413783802966741681"
+      "163408823070621548051648626121786722829331786695537057463075426413693654503038444945346737366821"
+      "225133327932005485066245444714745501565124397629114715495522938458074699526251211069420210767131"
+      "750436118840829770404967124939188832690342420342247494642147278007798251424033580379012449506316"
+      "934165643354254486972153730655788445304392046416644141199379603948408392592576221700479011277208"
+      "479324643050387964678647285623728517747346588370907253897677314279234316118865299414156764847705"
+      "743984311952110110767602453275087560730748137623587203804380635964288889352292469261855664366041"
+      "065882888907257708849809116284192758640026046474531298622540461742117012139662554171730462089369"
+      "460275716909739782826986323761645338353010120745573848411450802458407194135992155352731120859632"
+      "09",
+      "15037922004270"
+    },
+    {
+      "201807188929302239436128204353151687220002078014799772144932644784384290445812404031969491924271"
+      "622229551742667972466981453869159074990123258324464238581703441909514392713540548320716655131014"
+      "855638044154848099342923182787577959710924153146109648037260826134635671178088498292746435122701"
+      "336008681656814731513059453451418101294888410810980988243286680639127257012095424006472433427910"
+      "653867127126717383230425677445389866261537158302810947599531639344009268797093179278946760189801"
+      "664005257890563388788767226043386115911907331195994131537448883936891906370457657077236809089913"
+      "509094521716137028737275010579241734826702269785320060186190662382737678646569504061564559219327"
+      "543695816146581951300511131395173942041538490635461871413712455353126870769935183236822269026356"
+      "3846375126230505068426025553466479619157307634297607494981755990820870157027966119107700013",
+      "3378"
+    },
+    {
+      "-37123920365293398965934676207063974054635668817692308285013202147751536410699722421111754884077"
+      "712297571626159572837510000261168925435743954722899004315466258538525265334560039702532743342825"
+      "139208988773931545988570229578111539053555176686047488981017521455423227592543647431102892345684"
+      "409289334577269607725352637333016480816601974748504414938876319573698205398023370713083122027923"
+      "476724028357124015457244336672421307321557861801871657347300406209563989383210699652523980880184"
+      "363817436996668644638598546705236751289304054041187849894764729553882536805720592920207836286468"
+      "752039725980990385871606529888594963223865221311256408682865326688704554448002907224482830192376"
+      "748755200674010945422237925216441746944762870315515686099987386729190595252935946498790686303290"
+      "882264323949697927043941154906181702811230353612371788043157420843109225548057744301117853459287"
+      "53",
+      "772590"
+    },
+    {
+      "233539928281682397144228763604675584426582129698587509237197645477617193438672144538618049985987"
+      "758635228852250818157089951549837534430955113719241445933642459216372141884653950874840134705722"
+      "491469961456522529082617589693998456963620858352860292319843195908355357649433794531419937783240"
+      "366595403310433292809004747435067892014584550340146491427319452853235899859188695839724373253041"
+      "805566790600408363217985778616020469664637898510899443796669465717217483480222650770778341841593"
+      "290683800814951952086740603773927067300292044562535918813620072914495855687855763602749814085749"
+      "579255440589277654058253130612382298920013338007492132443803459376748400442157535565868044766616"
+      "562196913015267903318435354647498759396772318730186233659165614126921527143666045718036703137967"
+      "415196488844163292732143279078561708210776046862978305153880506024859310948059607952076902572023",
+      "6"
+    },
+    {
+      "-54201969953659467746407019972789787443653187003535006226823208747372751184757973569226306826920"
+      "246576421894273746805039401598665938268088278994210766839188940743584351206219447905513807448163"
+      "588865286817477631903141710485765934989358657431789562213403110890968700379904932683544903167415"
+      "750567564892634252738065028846238221030304288322771459472853868877111058646644183577659686349196"
+      "744283581115350822812544866460203456175624894178735479775173170037177247092725479632673074059486"
+      "229896186829594861756925993337077572178634750289661559003735838868339980586854397372386509881909"
+      "206075792144863550020428678392365613243640546202113403976274880889687825140753718615620540695192"
+      "190417018679118849466118084515191377884710750715785919601569872647287282582613122423152979929086"
+      "168335782452425324786918605327644352989520702943498819208850317848589162150629931056935497158465"
+      "51468569",
+      "17070"
+    },
+    {
+      "407457278626421914346919290012023899660046160921100003409932578585140608152278895349901340082807"
+      "259299507948110742863403231709578437000029689419492974640237519090408298054266448957637949889925"
+      "788276903685552337398167952996484224210253645691379357264048427241221004554005555017479656644336"
+      "413955812643566502459271342110850922054936916856132203146507399586822377449725073475078319539493"
+      "149139756581392063978699870994091117564215465304170848873582793367172170157380371344605802539658"
+      "467899969838065786673052604201712839652010105644900376189627407332681924292615888704880663869014"
+      "225804800275560051010987125100448969309489576874547190268702955767741313067619235434453737299214"
+      "764884675420007436627566864792773315433672746467430584848691803791218707241639113312829741079096"
+      "332441089031881644528059283060925212248763508313477785663568357633542981922494265169054338553510"
+      "3039143066710545",
+      "1561971642"
+    },
+    {
+      "-78923492634142225308597184676084932504610038326558551925046878667468131977091636767142821484782"
+      "173481711901886281906816544812713431718206522304837674449814957014805757854114097845712411430476"
+      "952509590421236784872992309470654467155316580555859899095508646823369468452149070641045032315509"
+      "074419333033750342330648637625813134042296693038128382601601181054002897898815407409095417259652"
+      "313859234925927395478064647558356201029230425900277387657591836250391058251821051665039949483638"
+      "310820914257519018943261740029185611695706939700174402185715310811015225685025877855999589780316"
+      "881383667063557444332762797782655903978493607679957853481701809061262425474921872641625261005980"
+      "313327330088577663315289824325373654902820807815408308380116965286839791468040521761914457307979"
+      "649906297348548237473996469302812799342899751242996479761773286553694900408994706869845589611787"
+      "6484325482410619",
+      "36570"
+    },
+    {
+      "895400754684121341894898910546469617644332933814331850188559653767640539346818102722140214683657"
+      "010685297630629616265238247456436518906323838268053413457897390523295191735544768179846457776413"
+      "058873275929181991419816676877840319399248846070201067208340714718639398485878473459856125312899"
+      "645398761765633981763894705520773333161290044238341676074516262133581449136369970288412666516052"
+      "824104435233936616954990944644596664361139423212556049632809788383997276057743713597611532947626"
+      "611005320528334036062766065274813273430469570986313240419783957670788943745392827615074326420225"
+      "630474084906663738935867992622780823053621178759738674877222309653356583368833544800057725961557"
+      "182284143082606742812128183934961828234534565105386494339100579775074368156093824661860787107196"
+      "592082442197479094350465085935010368917432154233894749384326913972193674834874516271548337915511"
+      "48136734990093221",
+      "498"
+    },
+    {
+      "-38807289881532469022078038805443936994330523214318196735637683263662583940392605557282712533282"
+      "516756666919539426266422557684134014238407199317916915480727656244111995712685835047924808932860"
+      "056093375623731999779267212410249827044330151392935511662971534087898484760737220746917126027575"
+      "902708937602628325122514356595433782966605998317885889559051990233360748106207368435373718345187"
+      "380951970082615325480069222905346178961860766621215940324196970733329049528965752060174318363840"
+      "549774016678339354995241220862439538209659705474784926366311930153972076044017076505163570729397"
+      "562384645930326761213832040478500582877417304825409742138224911986943065886130599606602783960854"
+      "405787504142823460840304226632283722460423002359183104394885957530215032230648576752112045075407"
+      "602245021860265575873377614298930845430388239374813274723340683819295169402934423419832790566792"
+      "561775366448094077182269546990219181",
+      "25727323650731430"
+    },
+    {
+      "764564043745475689625358233405220688346449276401730491614176918366269449102852720128326470141048"
+      "958476834241654595578879175107639033663856846714075819049547860691296253223963906468772952440649"
+      "621222427928986116778891639935242869463521356046811987293533576549569944872259726296583396840067"
+      "412726753466757301412905378508223645639208760305284477836080978170343670334255957958922965667318"
+      "495978076709299841902486488828740813223633796404595805379009874730623329689389106334619662446314"
+      "074353852228538667089781100891875017554086645954984687970402558219845958663743889974621462656381"
+      "385109100469517506181309495330041556230952228897002138118192860155872205885782107299855785856806"
+      "438977994944664788106127892641011630359311429018369384243401753612293688775237371960114861734948"
+      "447219150453043082117389416732937368218568289215949918306287717527388277110799727636383511638103"
+      "08806638474895438775679",
+      "6"
+    },
+    {
+      "-21104515755126258581988099584495966797649068148360570342014188760246785958272683768479825743046"
+      "268679246199437544160423275011457938674488914945899460803350968592585905664326524976348664447446"
+      "533956105214350217838237718236308775562390814653374452586861025138180892491122135622761788732214"
+      "337660182904374311534958053760105509209420270740229734045891128103778740547166696376558190853616"
+      "129496920034721947418374348620900827053069057865557338083755262867677157849010343772852915923603"
+      "023594693426265543130106566608848379176611074385750007764333515369326023161795590782164574965614"
+      "640011546931066426007053045376649093969420783432816175385369542968779993847531121732267098888361"
+      "915809621164088082478383818215978446162345122893729218798064388461480977921431022463727117391031"
+      "559181702282016705888250144218273773101892218251336296851616438282809898393671414020253663265593"
+      "49026535835606329956118300218049",
+      "19470"
+    },
+    {
+      "389940290490505794145615754986493146603885403838146761497096955568805661752812456909079580602926"
+      "520458383090509224761151055813552797514140210869549950389223803408828221104329183491015293692288"
+      "940051537208877576130820766537501775709692096711114163151243877600484279915906875665406902743476"
+      "876812357192062439427349983226159465035888538551319021049352402179695078939681361489292201387121"
+      "607545745365222735503319646151560351241616250237043025558336475745062944930449922738479988931883"
+      "789522583985991342424453654265871849290221403014519549718876854730073436140946719643904456535774"
+      "429083059267888853765663833450690434506205732251684880918036318409227269299413158420323408716153"
+      "249705821298391156106600888212129287336467008283669405930722443728929758399708355618135480163750"
+      "738262599777505012313629853772749655349553407723363598890035340250057895459739844578624051949714"
+      "61669153950462276063814122913377",
+      "42"
+    },
+    {
+      "-70381636494801248843782868551007693130071864397663503612736573300057649805227115208487798860177"
+      "317543991711699013824079350141481989208700654482628186525482301693762923475687436746934487679442"
+      "604567273558972710870926712476340755886255695145701498933070613274828010375037689169698418638755"
+      "085393057209893090180940002106642281967181274643082018489174577379964810939263017948442637865098"
+      "737422732303450562498842294533723770681855664872930984691688877586325164125496507328911752141952"
+      "281014351303126666676752084871168578975483173623537565814659388711588339118843954939993745321157"
+      "296252168036543285913523638973791012374476110668822738731559371466121747880865702181425181053904"
+      "030331288871719554804130482349233578225832626355274548151858594000669528450379250715504443806380"
+      "633455433896690293886145388700714248326563884355058277505564176009284158858662301917854894988101"
+      "924728004191978596080362551169917696293",
+      "8790"
+    },
+    {
+      "244880150023689417851569872635647637024597274141996121710500373483959778134465362888553147153601"
+      "305230433519724259816948413513752427863659546445392963997483728601960673580722140004104162696031"
+      "048697888717780655734372514592831917140699091334720766054643485626137741080947808019349119679929"
+      "259647219272744758193793203013470832331404795691778911098027429848059753960123828595665578844950"
+      "471219605576709611351664945220428806982887233408034985515902644135911076403828980912577191158064"
+      "997993558578409561692457674428234975483009425498206467167158855848979568274132531324674903579184"
+      "081822660487117401274955208037679340313607197474741162846378770767738913689498041311406420585511"
+      "042745916848724220308908834930585593486456056200660041139918156370312109455496111843132879388573"
+      "015533681857897436289296726890667031941311177162515265667487866831307936241470906027060817819461"
+      "200182415421609257484954079225869807742021",
+      "3522"
+    },
+    {
+      "-40767609682406979640250981744591774863482174541496376616197457600209084935859366369440100360529"
+      "720255866615932398599534412798746792507370846085978598861704878359885699142445556113221618794466"
+      "906535177307032149641251390614579016177232116633759849331351536201773206199063534922193292523252"
+      "426575111473203090775460280727810982951067008381839716331181104345037940232686475480040010299819"
+      "867894142206365004008232320119206185856270767873017417940089379242356494118997545533388031748665"
+      "675109984162628927436862099525730274542790930369942261870254431581721441868281998491376064749577"
+      "120683782600700942504532694188550249134905601713909613922774389913541211432607151137297576702626"
+      "208791497559700508338436274722699719422510106984005917821327893297767837846165823548468430103957"
+      "681386912387257697635998166723665177040044675715784363465263032659201205172366395889428211525716"
+      "1339112601024773890615175207513447796813539857023969",
+      "670649070"
+    },
+    {
+      "353159933920923640148308058830731815633794363002599330815821655526863571316927710458029528268025"
+      "536923713623477804946105123346797437149076276998814013435640126610340215264971119171698230336386"
+      "230702822699227009108343756952768538458052170606383900471822908498298935853901909134352067918414"
+      "327461675541262948939556957236257017619479099887927014779975804399420113729878704191899089806218"
+      "149131127575967980609799526558521625857882820227597394733588337521052981494327670901555944977865"
+      "409532187152816271762447903437167518973778441314097036483500517706661267209009136757154286811787"
+      "375307633094483921764494031155363467015088967418678339573264369181939976786960649883444407237223"
+      "030117614509477198016280927905141481098788916645591499598227031580540242709473972797097467008740"
+      "366860616044501709246125167829963123354958870223546654752556304460518996788597023301189557869390"
+      "542915167479645785033684717770396284623069988045",
+      "66"
+    },
+    {
+      "-21369190963490810272698354095936409481567056546191280188453404725010021511252728337498044518746"
+      "701402637005324606026379469997780655010792251768056881086264742501919831306525193142386805901399"
+      "585132978789998052825043357672060374654599290787167341078472874708172138521227059660187285998954"
+      "733346006190954032657571553893588138932156756829504467492656354502473418846534581043660320836339"
+      "983458317648347199311068769325636162888900703678144297602906311122968746987253185677327007591480"
+      "994058502257155668635157722593321046912046374971050330106358753425671018369450788856037961318981"
+      "468605850077142868267863109977425779195359725552926338199005253775099569921527092561345375525685"
+      "940938282799840953468404318940130672884253381914733785533257100389716462345391398042400365243426"
+      "257242770867363541199862044374066022883308514176639064208394093296244636229823387344507206251760"
+      "25003513159877146112604070531738592778847586396893846054469",
+      "45062070"
+    },
+    {
+      "103542095569540287363449206089017325853194627680282163948800616086890629518794422724881285683203"
+      "655626550847419760695463389526152512158437330672247729901557178972045169826440757428827743249851"
+      "212088971218823605220239284974222739031107871724766258393227003107694055957732789506340748065412"
+      "389013087542761113817091641305068574175570965574213584518977258539902792488524648828199894745454"
+      "936313586385963381306653252872757652514041564663529579951497930737198856221253042937962941430529"
+      "245932400748710504685184566985952107355347191655865459932325895793107743154974461795605062061778"
+      "394664346272538231518044594509514317304185995912817413765060138987167917307865624256520821328191"
+      "058364108789514202746008506152556581708309638123317064669174333637774930214111313309238438267484"
+      "977861547600652580507094335988595794086904391313442717139088783869103752036163778572391136913759"
+      "464596087307133820205711460281773406037410619696151281644860209",
+      "244713882"
+    },
+    {
+      "-11402053838483486555828229873080694476840844260281624543477380395268056463104788326297967335002"
+      "220425453701842868016519232528614937324357330832688776701142913692269977815310491266599005300367"
+      "411899179928058035070164048758364363878394630425056183931588996397990893939810225004185149140923"
+      "368564685104183708117630626857675310293067076507151850570802805923675735130846671578286067085817"
+      "634773616383307647529951614770768241341085777865516773484805194069243285799745327210247014199144"
+      "355757573264489316509689609143150100803321176642337304995534144092844841152662633444524477786640"
+      "315665294209708826783368209961356731210822975640392234702749121280259675566559523718026528592811"
+      "867311134841523066947626329402253478922784341289475926951925018433330380530888533956926871494705"
+      "739346971748115204491121459975616005985049732791615457382856486383636900129304715917614973057632"
+      "4834372628587274522655932579445271289490178906196047725435801",
+      "30"
+    },
+    {
+      "580568597823809832578124741352398046253738469157310300880923830090677098829502217735655427384286"
+      "541462959761717577774269137535788348281945001623929786012068523667997056243737086070884811171066"
+      "353177196249012143660320814085524726253330855540340779807297626763674449884090867366392578629654"
+      "075168666071772722250446910137390218680758926300904750289333352998515363226995502392862046964855"
+      "445332874975013711303974152164947365582061017076232208520791118742345281748893391096321701030583"
+      "820080011980244655121354314006876053919171050351559886100730572216674036798032642810342213467960"
+      "500359662417537561371563786963708314524396561178574151518467533220105515965052542525817636169051"
+      "457747975436611794568497618681376629075204131321804205572429824681291275674856624926276305517578"
+      "688560149070309500359828767229688864645264065390682344821882707616995705296127160441765060214054"
+      "0880442522168191806419996178244599870658105137244235781656230669567",
+      "168918"
+    },
+    {
+      "-66772780000907001624265670323694451254120284004127877874801588808693197232752542556767838336781"
+      "106394308664127150030924384122430846047787718907658520302734727006942107534500913633351464886109"
+      "662186655410731670042128414036981833955416529661550201092045365231263101284910532500824904974853"
+      "868204616918634759150393629643489357975173023366946927521839715119407168011554464251583343942774"
+      "925582579022092306451345159429814914204779750473066600640656744258206010475365949274429367354916"
+      "577955718547975619726266980820379078165259865065821132465206978991336333182755350798194272795115"
+      "920961130797094323684015138919533029257155031027894586438032015759717920581777304863685276357405"
+      "382183681450434518501808625219193439873725953320439400036813280489582245545781503649347110773239"
+      "580812381693290808061300581256808474596369239881813062739802766286435956567443282957186797629138"
+      "82680874320054542543100963283569438153746943360158805353625486236702376603433408481",
+      "21340446944246430"
+    },
+    {
+      "172051484434633429029879815726275188794317563955613342866753031341344033041679152108940552587179"
+      "229712250994831438280846711284337132914720502610874125147436068638092159966123358532560295884734"
+      "434671194421180209483533186352652329779460450911016922412506224680900609591649352008176288343736"
+      "045735342039530559653789974774688873538444492100576353748242573254256361628171389632303711912736"
+      "545206245418646743186027000434150467153300085682147025457117414378843932180462419775532830215538"
+      "315319597949885868201837750282018876880221722051563769046484586945158283473181277703185561917380"
+      "515702823705192833990360575492919845867506710136791142323087347474196430357557883850702030209117"
+      "704080828464355525432867996738866797615480758086207175439915259440378568710358352579081412811805"
+      "999835768689650022730033322199335050213570861791443735349787084377864650824838060030916718132082"
+      "23498301612113167541084043364784592073671754333469816689928263722694671",
+      "6"
+    },
+    {
+      "-79363889248172717428893036613485291778248095767149350546234840463169811240504917696538552908213"
+      "384400881116912499997347562143251370911455424720259144055703710069278871707642159115924628493824"
+      "202466573450191585759061668780192226723197218080771519476927200592823378527641669080061061441856"
+      "715825518947888742374120826769421161635889870390580540998750998726001131611833394861685402652245"
+      "438251459014009721389109234551707832932157617545636328687849891019749960542985132869809932932326"
+      "833973118245881116265522064551671140762337518575778039088213650406321918490039317852526357464667"
+      "534223843565483665445154555139051467510740611755281571505782431343807114972311127103585280131452"
+      "379915205392802716369234815767535770290841540164380618015016151282572452640134588477325238181934"
+      "578765563693312404236162470498901798476811840604358588823518486713541020375416155379795655766798"
+      "8562257881562724742318575671607041945898348726589393236807818986577030633001",
+      "30"
+    },
+    {
+      "626336803036570943788514124576273528588059915669303116584390011618625388641062356471332737254201"
+      "757301896084326343410183488440625994159383097801211647635669508398645524280773043596760219901432"
+      "534061781094371687024191684466731406730164469241586754916518859139143830433231372267784473846284"
+      "706922822515388613447274418750078102895933591276829589772468176878062085367971772712224002575961"
+      "826455103222517665130263038902846276653848426080282607040435417332630193208147228150960774012940"
+      "220619000331450226294543588160037911530900217999044412025631611821650295710217794098222400327887"
+      "086022920507869077118230795272689272841941043326555981237502001817536373377700285970855879207501"
+      "639682420923274923426208578966525255499422607950271797941667537634413860424367979143768521305287"
+      "323216117551802366143993794825155280018223531329260594861738269563683049772821921734769724205410"
+      "8154809330396206889395612376259673152960991959269629619021606645776233307951361807",
+      "25494"
+    },
+    {
+      "-11713121803601529329834994341379603839711392133406406121066457035627332512863412227389313184308"
+      "377257455042610109548131083453044082105199539163318325720415845279444785948237618965376593264919"
+      "732384961874666652651532363739290031159100396978679031263603222604253802896744322978600693205905"
+      "046860732792710642121961610208639679240747644032940841865838060918484453328358404817865346016378"
+      "025023858768461473800226423995697388513931865020423957144346854463442438397773046134267540999335"
+      "616149583462668173119236164566447973867295125554070444386573372471147723255477808114986231328015"
+      "773879396852560614951786595968868648305036119778910378168690307310154657093099207396835483589712"
+      "235909296562539698447623517053664515133477445821152082151122083466796332525607168717555289261134"
+      "335719325911852115912553061010552335636947536777355855589097552585267270373672067256537744131984"
+      "50342364312406018408081050712427244575773339984855108026838255627804349953264705390017",
+      "510"
+    },
+    {
+      "142637530048186355537202018056468659986158777589784878595478524800658969836705042548815173409077"
+      "614826372151322372861227514748817539254422997178173292910097926860886569247926508012320514148829"
+      "314819746710281929190167260528864166680922943869406000800206370490891490164348302427305663830750"
+      "342084969405122016764025562750829861072439054659712474753703454648722106637722322440193512953988"
+      "452663711625757253874992651958305246492576741096971047328164491010063244734107433994730780876063"
+      "092414260791595715561840813748723193755294521033549330206230059889305474013649349622714727445233"
+      "257814464003455225032263942063762799665823569535132058567342871799130349410449975733818056492436"
+      "489703009585265612817550943822311053442340987274809203668704892025168514042502812955886500427182"
+      "359181171590647356235481364314736462524041142964539777744852543765068662651345375251968933074297"
+      "0628918165862401911075901684396694473248756523229948167731709512204628061529006713882805",
+      "66"
+    },
+    {
+      "-76151211461526855861605052168282695510045220632965495075110095695482678739643568910938267286951"
+      "880268016613470053227811560764800356121217043343691149305593122236787883552674732819161415467533"
+      "908482747288894516529280020657805181233022200506495335094202109169702105454780560428184779194936"
+      "200478918621092645387208578633802884335966344089876682962203266270695460325208853288767042876744"
+      "641148856233478890099924417956440836898343446977273459919155956218883206345777252802057173993819"
+      "119004601829083778053460377081533167400583913039055095271694322774903840005429123815517214076505"
+      "666503290550160186808541988820159171381355979131888265325353146343046588430675415103585182148079"
+      "825121700212747268009106098182784767007616559651025389075243934893362578112515360150415072982928"
+      "252227890933419513425612909241992805186861614569232899966298047400769554657698354639158608161072"
+      "555356595545601299849123001015578489565502486502090348473421611635985941888116584485805491845343"
+      "11774229",
+      "37200951384870"
+    },
+    {
+      "117096288362548876962764174047968222016603457631943687341165324424053437928490542643812013606252"
+      "012101373187571187373298415401220576568984300340472145305486540650806765537813487476645554743655"
+      "508976999087302737724753731458246417208631642247190851637842612040713842545887489141146577175079"
+      "374374476739269479868408465079333523725400389477627274360745691244927255890720887478094894041696"
+      "923803015417589232337439093071899966622842806834286257402947986284801492098753884550498716850488"
+      "736956976346266102634871387429422454333519143386913537577870330876061828462976264488180893886138"
+      "272372358059545098474577697942969227785938498602075924735395114603469348597975091163486488414843"
+      "619074121767002938375729508116302427897402824274691060798475659560132551298356410463431008256309"
+      "394639133725894660845099093468529653607352004813109584496477564319932585519204188807067432096334"
+      "61975734297525641197636386631881692971993482096648796722151228847781758015846103497741141910807",
+      "6"
+    },
+    {
+      "-20578334836160473869042016406407373156413002907256309367401505590495838421156891891986636904554"
+      "537207720145131123495401875897544830661157001533021834793096373249318781293253306982602000261670"
+      "660172538313099210446833389965746136394508162418471559220536715495823791472328525007271950462126"
+      "548067528493989327754260227316646110866053689559608528211254657606056346991805732380052705651413"
+      "486863163735281369039832991456542076838975210713009970149814769422699209831875883640043537041408"
+      "526037084965996882352330058635447129039031097121666640674471757734181109121959916025315015774548"
+      "756767517535530506586480685757350363708379453705331844967110773410773433000428091540346199658304"
+      "297113527297663690010800288658870636520680004235977291454802351415345559749509639442558942039330"
+      "969566829798303702644222193459665302109264069345444222077066105821883635644769548958552997158703"
+      "980914905066021302203214447147645760692172870655963224387620345904815253445003325920343402935167"
+      "301627223771",
+      "1098809130"
+    },
+    {
+      "470264084896834921253579065941496255260089485866270014303628287029496536092621484833778726679869"
+      "885329947026300103418987990080507411462429220614450222194367846023657693268884688798641908735536"
+      "121171966868861026232193237019817193473337188238008923662432751237463367033103193718153178301971"
+      "304904486457756647001228162178299038336923657342738284926828143598861803949957686723525483884989"
+      "861564070786286054991856832659421801273075827049417795544639891259694404163721748484505714592978"
+      "199025098730045640458194417736899554453082747917803868343428612691354309654889818955152593250619"
+      "139979061837411785730119028465048534821850287972528338280928240147732374404405298971983743987095"
+      "154184664405335381351186455851302872623016096375357957012687527051132607384834924505145250804632"
+      "820506663947050107426998056881814940280066342393096275218917156216006459134433258238830004615192"
+      "602902121514164167485505102171587364814568785449329429719700071208384539630650649317307113478824"
+      "1426384067",
+      "25998"
+    }
+  };
+
+} } } // namespace boost::math::detail
+
+#endif // _BOOST_BERNOULLI_B2N_RATIONAL_DATA_HPP_
@@ -13,22 +13,30 @@
 
   #include <cmath>
   #include <limits>
+  #include <vector>
   #include <boost/cstdint.hpp>
+  #include <boost/math/constants/constants.hpp>
+  #include <boost/math/policies/error_handling.hpp>
   #include <boost/math/policies/policy.hpp>
   #include <boost/math/special_functions/bernoulli.hpp>
+  #include <boost/math/special_functions/fpclassify.hpp>
   #include <boost/math/special_functions/trunc.hpp>
   #include <boost/math/special_functions/zeta.hpp>
+  #include <boost/math/special_functions/detail/zeta_integer_values.hpp>
+  #include <boost/mpl/bool.hpp>
   #include <boost/mpl/if.hpp>
   #include <boost/mpl/int.hpp>
   #include <boost/static_assert.hpp>
   #include <boost/type_traits/is_convertible.hpp>
+  #include <boost/type_traits/is_floating_point.hpp>
 
   namespace boost { namespace math { namespace detail {
 
   template<class T>
   struct max_iteration
   {
-    //TODO Derive a suitable formula based on the precision of T
+    // A cap on the length of any series: the lengths themselves are
+    // derived from the precision of T, see polygamma_term_counter.
     static const int value=2500;
   };
 
@@ -79,73 +87,262 @@
     return lower_limit;
   }
 
+  // x as a double, to about 30 bits, for the term counts below. Without
+  // C++11 explicit conversion operators a multiprecision type only goes
+  // through its own overload of itrunc: take its leading bits from frexp.
+  template<class T>
+  inline double polygamma_estimate_to_double(const T& x, const mpl::true_&)
+  {
+    return static_cast<double>(x);
+  }
+
+  template<class T>
+  inline double polygamma_estimate_to_double(const T& x, const mpl::false_&)
+  {
+    BOOST_MATH_STD_USING
+    using boost::math::itrunc;
+
+    if((boost::math::isnan)(x))
+    {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    if((boost::math::isinf)(x))
+    {
+      return ((x > 0) ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity());
+    }
+
+    int exponent;
+    const T mantissa = frexp(x, &exponent);
+
+    return std::ldexp(static_cast<double>(itrunc(T(ldexp(mantissa, 30)))), exponent - 30);
+  }
+
+  template<class T>
+  inline double polygamma_estimate_to_double(const T& x)
+  {
+    return polygamma_estimate_to_double(x, mpl::bool_<boost::is_floating_point<T>::value>());
+  }
+
+  // Follows the size of the terms of a series relative to its first, in
+  // double, from the ratios of each term to the one before, to tell when
+  // they fall below half an ulp of T. This fixes the length of a series
+  // before it is summed in T, where testing each term as it comes costs
+  // about as much as the term itself at high precision. The product is
+  // renormalized into a logarithm before it can underflow or overflow,
+  // since 2^-digits is out of the range of double for the widest types,
+  // and terms may grow by as much before they start to fall.
+  class polygamma_term_counter
+  {
+  public:
+    polygamma_term_counter(const int digits, const double log_first) : m_remaining(-(static_cast<double>(digits + 1) * 0.6931471805599453) - log_first),
+                                                                       m_product  (1.0),
+                                                                       m_bound    (bound(m_remaining)) { }
+
+    // Whether the latest term is still above half an ulp of the sum.
+    bool above_precision() const { return (m_product > m_bound); }
+
+    // Move on to the next term, given its ratio to the latest.
+    void next(const double ratio)
+    {
+      m_product *= ratio;
+
+      if((m_product > 0.0) && ((m_product < 1.0E-150) || (m_product > 1.0E+150)))
+      {
+        m_remaining -= std::log(m_product);
+        m_product    = 1.0;
+        m_bound      = bound(m_remaining);
+      }
+    }
+
+  private:
+    static double bound(const double remaining)
+    {
+      return ((remaining > -345.0) ? std::exp(remaining) : 0.0);
+    }
+
+    double m_remaining;
+    double m_product;
+    double m_bound;
+  };
+
+  // The number of terms k = 1, 2, ... of the asymptotic series
+  //
+  //   sum_k B2k (2k + n - 1)! / ((2k)! z^(2k+n))
+  //
+  // to take for full precision relative to its leading term, (n - 1)! / z^n
+  // (or 1 for digamma, where the factor (2k - 1)! stands for the factorials).
+  // Since |B2k| / (2k)! < 4 / (2 pi)^2k, term k is less than
+  // 4 (2k + n - 1)! / ((n - 1)! (2 pi z)^2k) times the leading term. If the
+  // terms start to grow before they get that small, as they do for small z,
+  // the count stops at the smallest of them.
+  template<class T, class Policy>
+  int polygamma_asymptotic_term_count(const int n, const T& z)
+  {
+    const double two_pi_z                  = 6.283185307179586 * polygamma_estimate_to_double(z);
+    const double one_over_two_pi_z_squared = 1.0 / (two_pi_z * two_pi_z);
+    const double n_n_plus_one              = ((n == 0) ? 1.0 : (static_cast<double>(n) * (n + 1)));
+
+    polygamma_term_counter counter(boost::math::policies::digits<T, Policy>(), std::log((4.0 * n_n_plus_one) * one_over_two_pi_z_squared));
+
+    int k = 1;
+
+    while(counter.above_precision() && (k < max_iteration<T>::value))
+    {
+      const double ratio = (static_cast<double>((2 * k) + n) * ((2 * k) + n + 1)) * one_over_two_pi_z_squared;
+
+      if(ratio >= 1.0)
+      {
+        break;
+      }
+
+      counter.next(ratio);
+
+      ++k;
+    }
+
+    return k;
+  }
+
+  // The number of terms k = 1, 2, ... of the series in polygamma_nearzero
+  // to take for full precision. The sum is led by n! / x^(n+1), relative to
+  // which the first term, n! zeta(n + 1), is zeta(n + 1) |x|^(n+1), and term k
+  // is less than that times (k + n)! |x|^k / (k! n!), since zeta decreases.
+  // For large n the terms grow before they fall, and no count stops while
+  // they do: for x < 0 they have one sign, and their peak is in the sum.
+  template<class T, class Policy>
+  int polygamma_nearzero_term_count(const int n, const T& x)
+  {
+    const double abs_x = std::fabs(polygamma_estimate_to_double(x));
+
+    // zeta(n + 1) <= zeta(2) = pi^2 / 6 for n >= 1.
+    const double log_first = 0.49770030247070646 + (static_cast<double>(n + 1) * std::log(abs_x));
+
+    polygamma_term_counter counter(boost::math::policies::digits<T, Policy>(), log_first);
+
+    int k = 0;
+
+    while(k < max_iteration<T>::value)
+    {
+      const double ratio = (static_cast<double>(k + n + 1) / (k + 1)) * abs_x;
+
+      if((!counter.above_precision()) && (ratio < 1.0))
+      {
+        break;
+      }
+
+      counter.next(ratio);
+
+      ++k;
+    }
+
+    return k;
+  }
+
   template<class T, class Policy>
   T digamma_atinfinityplus(const int, const T &x, const Policy&)
   {
     BOOST_MATH_STD_USING
 
-    // calculate a high bernoulli number upfront to make use of cache
-    unsigned int bernoulli_index = 100;
-    boost::math::bernoulli_b2n<T>(bernoulli_index);
+    // Take B2k from the cache, growing it by half again whenever the series
+    // needs more terms, for as long as the range of T allows.
+    bernoulli_numbers_cache<T>& numbers = get_bernoulli_numbers_cache<T>();
+
+    std::size_t bernoulli_count = numbers.ensure_available(101U);
+    const T*    b2k             = numbers.ensure(bernoulli_count);
 
     T z(x);
     T log_z(log(z));
     T one_over_2z= T(1) / (2 * z);
     T sum(0);
 
-    for(int two_k = 2; two_k < max_iteration<T>::value; two_k += 2)
+    const int terms = polygamma_asymptotic_term_count<T, Policy>(0, z);
+
+    for(int two_k = 2; two_k <= (2 * terms); two_k += 2)
     {
-      if(two_k/2 > static_cast<boost::int32_t>(bernoulli_index))
+      const std::size_t k = static_cast<std::size_t>(two_k / 2);
+
+      if(k >= bernoulli_count)
       {
-        try
-        {
-          int temp = static_cast<int>(bernoulli_index * 1.5F);
-          boost::math::bernoulli_b2n<T>(temp);
-          bernoulli_index = temp;
-        }
-        catch(...)
+        const std::size_t available = numbers.ensure_available((bernoulli_count * 3U) / 2U);
+
+        if(available <= k)
         {
           break;
         }
+
+        bernoulli_count = available;
+        b2k             = numbers.ensure(bernoulli_count);
       }
 
       T term(1);
       T one_over_two_k       = T(1) / two_k;
       T z_pow_two_k          = pow(z, static_cast<boost::int32_t>(two_k));
       T one_over_z_pow_two_k = T(1) / z_pow_two_k;
-      T bernoulli_term       = boost::math::bernoulli_b2n<T>(two_k / 2);
+      T bernoulli_term       = b2k[k];
 
       term = (bernoulli_term * one_over_two_k) * one_over_z_pow_two_k;
 
-      if(term == 0)
+      sum += term;
+    }
+
+    return (log_z - one_over_2z) - sum;
+  }
+
+  // Neither polygamma_nearzero nor polygamma_attransitionplus covers
+  // digamma, so x is moved to z = x + N, where digamma_atinfinityplus is
+  // accurate, reflecting it first if x <= 0:
+  //
+  //   psi(x) = psi(1 - x) - pi / tan(pi x),   psi(x) = psi(x + N) - sum_{k<N} 1 / (x + k).
+  //
+  // z is shifted in place, and what is to be taken from psi(z) is returned.
+  // N is that of polygamma_attransitionplus for n = 0.
+  template<class T, class Policy>
+  T digamma_shift(T& z, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING
+
+    T reflection(0);
+
+    if(z <= 0)
+    {
+      // pi / tan(pi x) has period 1: take it at x - round(x), where it is accurate.
+      T remainder = z - floor(z);
+
+      if(remainder > 0.5F)
       {
-        continue;
+        remainder -= 1;
       }
 
-      sum += term;
+      reflection = ((remainder == 0) ? policies::raise_pole_error<T>("boost::math::digamma<%1%>(%1%)", 0, T(z), pol)
+                                     : T(boost::math::constants::pi<T>() / tan(boost::math::constants::pi<T>() * remainder)));
+
+      z = 1 - z;
+    }
 
-      T term_base_10_exp = ((term < 0) ? -term : term);
-      T sum_base_10_exp  = ((sum  < 0) ? -sum  : sum);
+    const int N = static_cast<boost::int32_t>(0.4F * std::numeric_limits<T>::digits10);
 
-      int exponent_value;
+    // Smallest terms first.
+    T sum0(0);
 
-      static_cast<void>(frexp(term_base_10_exp, &exponent_value));
-      term_base_10_exp = T(exponent_value) * 0.303F;
+    for(int k = N - 1; k >= 0; --k)
+    {
+      sum0 += T(1) / (z + k);
+    }
 
-      static_cast<void>(frexp(sum_base_10_exp, &exponent_value));
-      sum_base_10_exp = T(exponent_value) * 0.303F;
+    z += N;
 
-      long int order_check =  boost::math::ltrunc(term_base_10_exp) - boost::math::ltrunc(sum_base_10_exp);
-      long int tol         =  std::numeric_limits<T>::digits10;
+    return sum0 + reflection;
+  }
 
+  template<class T, class Policy>
+  T digamma_attransitionplus(const T& x, const Policy& pol)
+  {
+    T z(x);
 
-      if((two_k > 24) && (order_check < -tol))
-      {
-        break;
-      }
-    }
+    const T shift = digamma_shift(z, pol);
 
-    return (log_z - one_over_2z) - sum;
+    return digamma_atinfinityplus(0, z, pol) - shift;
   }
 
   template<class T, class Policy>
@@ -158,9 +355,11 @@
        return digamma_atinfinityplus(n, x, pol);
     }
 
-     //TODO try calculating for bernoulli_index= max_iteration, if error then set bernoulli_index=100
-     unsigned int bernoulli_index = 100;
-     boost::math::bernoulli_b2n<T>(bernoulli_index);
+     // The Bernoulli numbers enter as B2k / (2k)!, which can't overflow.
+     bernoulli_scaled_numbers_cache<T>& scaled = get_bernoulli_scaled_numbers_cache<T>();
+
+     std::size_t bernoulli_count       = 101U;
+     const T*    b2k_over_two_k_fact   = scaled.over_factorial(bernoulli_count);
 
      const bool b_negate = ((n % 2) == 0);
 
@@ -173,61 +372,34 @@
            T one_over_x_pow_two_k_plus_n = one_over_z_pow_n * one_over_z2;
            T two_k_plus_n_minus_one      = nn + T(1);
            T two_k_plus_n_minus_one_fact = n_fact * (n + 1); //(n+3)! ?
-           T one_over_two_k_fact         = T(1) / 2;
-           T sum                         = (  (boost::math::bernoulli_b2n<T>(1) * two_k_plus_n_minus_one_fact)
-                                            * (one_over_two_k_fact * one_over_x_pow_two_k_plus_n));
+           T sum                         = (b2k_over_two_k_fact[1] * two_k_plus_n_minus_one_fact) * one_over_x_pow_two_k_plus_n;
+
+     const int terms = polygamma_asymptotic_term_count<T, Policy>(n, x);
 
      // Perform the Bernoulli series expansion.
-     for(int two_k = 4; two_k < max_iteration<T>::value; two_k += 2)
+     for(int two_k = 4; two_k <= (2 * terms); two_k += 2)
      {
-       if((two_k / 2) > static_cast<int>(bernoulli_index))
+       const std::size_t k = static_cast<std::size_t>(two_k / 2);
+
+       if(k >= bernoulli_count)
+       {
+         bernoulli_count     *= 2U;
+         b2k_over_two_k_fact  = scaled.over_factorial(bernoulli_count);
+       }
+
+       if(b2k_over_two_k_fact[k] == 0)
        {
-         try
-         {
-           //TODO the multiplication factor should depend upon T, small precision, smaller multiplication factor
-           int temp = static_cast<int>(bernoulli_index * 2.0F);
-           boost::math::bernoulli_b2n<T>(temp);
-           bernoulli_index = temp;
-         }
-         catch(...)
-         {
-           break;
-         }
+         // B2k / (2k)! has underflowed, as will all that follow.
+         break;
        }
 
        one_over_x_pow_two_k_plus_n *= one_over_z2;
        two_k_plus_n_minus_one_fact *= ++two_k_plus_n_minus_one;
        two_k_plus_n_minus_one_fact *= ++two_k_plus_n_minus_one;
-       one_over_two_k_fact         /= static_cast<boost::int32_t>(two_k * static_cast<boost::int32_t>(two_k - static_cast<boost::int32_t>(1)));
 
-       const T term = (  (boost::math::bernoulli_b2n<T>(two_k/2) * two_k_plus_n_minus_one_fact)
-                       * (one_over_two_k_fact * one_over_x_pow_two_k_plus_n));
+       const T term = (b2k_over_two_k_fact[k] * two_k_plus_n_minus_one_fact) * one_over_x_pow_two_k_plus_n;
 
-        if(term == 0)
-        {
-          continue;
-        }
-
-        sum += term;
-
-        T term_base_10_exp = ((term < 0) ? -term : term);
-        T sum_base_10_exp  = ((sum  < 0) ? -sum  : sum);
-
-        int exponent_value;
-
-        static_cast<void>(frexp(term_base_10_exp, &exponent_value));
-        term_base_10_exp = T(exponent_value) * 0.303F;
-
-        static_cast<void>(frexp(sum_base_10_exp, &exponent_value));
-        sum_base_10_exp = T(exponent_value) * 0.303F;
-
-        long int order_check =  boost::math::ltrunc(term_base_10_exp) - boost::math::ltrunc(sum_base_10_exp);
-        long int tol         =  std::numeric_limits<T>::digits10;
-
-        if((two_k > 24) && (order_check < -tol))
-        {
-          break;
-        }
+       sum += term;
      }
 
      sum += ((((n_minus_one_fact * (nn + (x * static_cast<boost::int32_t>(2)))) * one_over_z_pow_n) * one_over_z) / 2);
@@ -275,31 +447,14 @@
     const T   one_over_z_plus_N_squared                 = T(1) / (z * z);
           T   one_over_z_plus_N_pow_minus_m_minus_two_k = one_over_z_plus_N_pow_minus_m * one_over_z_plus_N_squared;
 
-    for(int k = 1; k < max_iteration<T>::value; ++k)
+    const int terms = polygamma_asymptotic_term_count<T, Policy>(m, z);
+
+    for(int k = 1; k <= terms; ++k)
     {
       const int two_k = 2 * k; // k << 1
 
       const T term = ((boost::math::bernoulli_b2n<T>(two_k / 2) * am) * one_over_two_k_fact) * one_over_z_plus_N_pow_minus_m_minus_two_k;
 
-      T term_base_10_exp = ((term < 0) ? -term : term);
-      T sum_base_10_exp  = ((sum1 < 0) ? -sum1 : sum1);
-
-      int exponent_value;
-
-      static_cast<void>(frexp(term_base_10_exp, &exponent_value));
-      term_base_10_exp = T(exponent_value) * 0.303F;
-
-      static_cast<void>(frexp(sum_base_10_exp, &exponent_value));
-      sum_base_10_exp = T(exponent_value) * 0.303F;
-
-      long int order_check =  boost::math::ltrunc(term_base_10_exp) - boost::math::ltrunc(sum_base_10_exp);
-      long int tol         =  std::numeric_limits<T>::digits10;
-
-      if((two_k > 24) && (order_check < -tol))
-      {
-        break;
-      }
-
       sum1 += term;
 
       one_over_two_k_fact /= (two_k + 1);
@@ -336,55 +491,45 @@
     const T n_fact_over_pow_term =  n_fact / z_pow_n_plus_one;
     const T term0                =  !b_negate ? n_fact_over_pow_term : -n_fact_over_pow_term;
 
-          T one_over_k_fact      =  T(1);
+    // Term k is n! times (k + n)! / (k! n!) zeta(k + n + 1) x^k. The
+    // binomial is carried as it is, and n! applied once to the sum, since
+    // (k + n)! and 1 / k! on their own leave the range of T long before
+    // the terms become negligible.
+          T binomial             =  T(1);
           T z_pow_k              =  T(1);
-          T k_plus_n_fact        =  boost::math::factorial<T>(n);
-          T k_plus_n_plus_one    =  T(n + 1);
-    const T pg_kn                =  k_plus_n_fact * boost::math::zeta<T>(k_plus_n_plus_one);
-          bool    b_neg_term     =  ((n % 2) == 0);
-          T sum                  =  ((!b_neg_term) ? pg_kn : -pg_kn);
-
-    for(int k = 1; k < max_iteration<T>::value; k++)
-    {
-      k_plus_n_fact   *= k_plus_n_plus_one++;
-      one_over_k_fact /= k;
-      z_pow_k         *= x;
 
-      const T pg = k_plus_n_fact * boost::math::zeta<T>(k_plus_n_plus_one);
+    // zeta(n + 1), ..., zeta(n + terms + 1) are taken from the cache.
+    const int terms  = polygamma_nearzero_term_count<T, Policy>(n, x);
+    const T*  zeta_m = get_zeta_integer_values_cache<T>().values(static_cast<std::size_t>(n + terms + 2));
 
-      const T term = (pg * z_pow_k) * one_over_k_fact;
-
-      T term_base_10_exp = ((term < 0) ? -term : term);
-      T sum_base_10_exp  = ((sum  < 0) ? -sum  : sum);
-
-      int exponent_value;
-
-      static_cast<void>(frexp(term_base_10_exp, &exponent_value));
-      term_base_10_exp = T(exponent_value) * 0.303F;
+          bool    b_neg_term     =  ((n % 2) == 0);
+          T sum                  =  ((!b_neg_term) ? zeta_m[n + 1] : T(-zeta_m[n + 1]));
 
-      static_cast<void>(frexp(sum_base_10_exp, &exponent_value));
-      sum_base_10_exp = T(exponent_value) * 0.303F;
+    for(int k = 1; k <= terms; k++)
+    {
+      binomial *= (k + n);
+      binomial /= k;
+      z_pow_k  *= x;
 
-      long int order_check =  boost::math::ltrunc(term_base_10_exp) - boost::math::ltrunc(sum_base_10_exp);
-      long int tol         =  std::numeric_limits<T>::digits10;
-
-      if((k > 12) && (order_check < -tol))
-      {
-        break;
-      }
+      const T term = (binomial * zeta_m[n + k + 1]) * z_pow_k;
 
       b_neg_term = !b_neg_term;
 
       ((!b_neg_term) ? sum += term : sum -= term);
     }
 
-    return term0 + sum;
+    return term0 + (sum * n_fact);
 
   }
 
   template<class T, class Policy>
   inline T polygamma_imp(const int n, T x, const Policy &pol)
   {
+    if(n == 0)
+    {
+      return ((x > 400.0F) ? digamma_atinfinityplus(n, x, pol) : digamma_attransitionplus(x, pol));
+    }
+
     if(x < 0.5F)
     {
       return polygamma_nearzero(n, x, pol);
@@ -399,6 +544,794 @@
     }
   }
 
+  // Evaluates polygamma(n, x) at many x, each exactly as polygamma_imp
+  // would, but with the parts of each series that depend only on n worked
+  // out once and shared by all the x: the factorials, the Bernoulli number
+  // terms, and the values of zeta near zero. Each set of coefficients is
+  // computed on first use and extended as far as the slowest converging
+  // x needs, so a batch that never visits a region pays nothing for it.
+  template<class T, class Policy>
+  class polygamma_batch
+  {
+  public:
+    polygamma_batch(const int n, const Policy&) : m_n                                    (n),
+                                                   m_nearzero_ready                       (false),
+                                                   m_nearzero_n_fact                      (0),
+                                                   m_nearzero_binomial                    (0),
+                                                   m_nearzero_sum0                        (0),
+                                                   m_transition_ready                     (false),
+                                                   m_transition_fact                      (0),
+                                                   m_transition_one_over_two_k_fact       (0),
+                                                   m_transition_mk                        (0),
+                                                   m_transition_am                        (0),
+                                                   m_infinity_ready                       (false),
+                                                   m_infinity_b2k                         (0),
+                                                   m_infinity_end                         (0U),
+                                                   m_n_minus_one_fact                     (0),
+                                                   m_infinity_two_k_plus_n_minus_one      (0),
+                                                   m_infinity_two_k_plus_n_minus_one_fact (0),
+                                                   m_digamma_b2k                          (0),
+                                                   m_digamma_end                          (0U) { }
+
+    T operator()(const T& x)
+    {
+      if(m_n == 0)
+      {
+        return ((x > 400.0F) ? digamma_atinfinityplus(x) : digamma_attransitionplus(x));
+      }
+
+      if(x < 0.5F)
+      {
+        return nearzero(x);
+      }
+      else if(x > 400.0F)
+      {
+        return atinfinityplus(x);
+      }
+      else
+      {
+        return attransitionplus(x);
+      }
+    }
+
+  private:
+    // See polygamma_nearzero: the coefficients are (k + n)! / (k! n!) times
+    // zeta(k + n + 1), rounded as each term is there.
+    T nearzero(const T& x)
+    {
+      BOOST_MATH_STD_USING
+
+      if(!m_nearzero_ready)
+      {
+        m_nearzero_n_fact   = boost::math::factorial<T>(m_n);
+        m_nearzero_binomial = T(1);
+
+        const T zeta_n_plus_one = get_zeta_integer_values_cache<T>().values(static_cast<std::size_t>(m_n + 2))[m_n + 1];
+
+        m_nearzero_sum0 = (((m_n % 2) != 0) ? zeta_n_plus_one : T(-zeta_n_plus_one));
+
+        m_nearzero_pg.push_back(T(0));
+
+        m_nearzero_ready = true;
+      }
+
+      const bool b_negate = (( m_n % 2 ) == 0 ) ;
+
+      const T z_pow_n_plus_one     =  pow(x, static_cast<boost::int64_t>(m_n + 1));
+      const T n_fact_over_pow_term =  m_nearzero_n_fact / z_pow_n_plus_one;
+      const T term0                =  !b_negate ? n_fact_over_pow_term : -n_fact_over_pow_term;
+
+            T z_pow_k              =  T(1);
+            bool    b_neg_term     =  ((m_n % 2) == 0);
+            T sum                  =  m_nearzero_sum0;
+
+      const int terms = polygamma_nearzero_term_count<T, Policy>(m_n, x);
+
+      if(static_cast<std::size_t>(terms) >= m_nearzero_pg.size())
+      {
+        extend_nearzero(terms);
+      }
+
+      for(int k = 1; k <= terms; k++)
+      {
+        const std::size_t kk = static_cast<std::size_t>(k);
+
+        z_pow_k *= x;
+
+        const T term = m_nearzero_pg[kk] * z_pow_k;
+
+        b_neg_term = !b_neg_term;
+
+        ((!b_neg_term) ? sum += term : sum -= term);
+      }
+
+      return term0 + (sum * m_nearzero_n_fact);
+    }
+
+    // Extend the coefficients of nearzero up to k = terms, with the
+    // values of zeta from the cache, as polygamma_nearzero takes them.
+    void extend_nearzero(const int terms)
+    {
+      const T* zeta_m = get_zeta_integer_values_cache<T>().values(static_cast<std::size_t>(m_n + terms + 2));
+
+      for(int k = static_cast<int>(m_nearzero_pg.size()); k <= terms; ++k)
+      {
+        m_nearzero_binomial *= (k + m_n);
+        m_nearzero_binomial /= k;
+
+        m_nearzero_pg.push_back(m_nearzero_binomial * zeta_m[m_n + k + 1]);
+      }
+    }
+
+    // See polygamma_attransitionplus: the coefficients are
+    // B2k (m + 1)(m + 2) ... (m + 2k - 1) / (2k)!.
+    T attransitionplus(const T& x)
+    {
+      BOOST_MATH_STD_USING
+
+      if(!m_transition_ready)
+      {
+        m_transition_fact                = factorial<T>(m_n);
+        m_transition_one_over_two_k_fact = T(1) / 2;
+        m_transition_mk                  = m_n + 1;
+        m_transition_am                  = T(m_transition_mk);
+
+        m_transition_coefficients.push_back(T(0));
+
+        m_transition_ready = true;
+      }
+
+      const int d4d  = static_cast<boost::int32_t>(0.4F * std::numeric_limits<T>::digits10);
+      const int N4dn = static_cast<boost::int32_t>(d4d + (4 * m_n));
+      const int N    = static_cast<boost::int32_t>((std::min)(N4dn, (std::numeric_limits<int>::max)()));
+      const int m    = m_n;
+
+      const int minus_m_minus_one = -m - 1;
+
+      T z(x);
+      T sum0(0);
+
+      for(int k = 1; k <= N; ++k)
+      {
+        sum0 += pow(z, minus_m_minus_one);
+        ++z;
+      }
+
+      const T one_over_z_plus_N_pow_minus_m           = pow(z, -m);
+      const T one_over_z_plus_N_pow_minus_m_minus_one = one_over_z_plus_N_pow_minus_m / z;
+
+      const T term0 = one_over_z_plus_N_pow_minus_m_minus_one / 2;
+      const T term1 = one_over_z_plus_N_pow_minus_m           / m;
+
+            T sum1                                      = T(0);
+      const T one_over_z_plus_N_squared                 = T(1) / (z * z);
+            T one_over_z_plus_N_pow_minus_m_minus_two_k = one_over_z_plus_N_pow_minus_m * one_over_z_plus_N_squared;
+
+      const int terms = polygamma_asymptotic_term_count<T, Policy>(m, z);
+
+      for(int k = 1; k <= terms; ++k)
+      {
+        const int         two_k = 2 * k;
+        const std::size_t kk    = static_cast<std::size_t>(k);
+
+        if(kk >= m_transition_coefficients.size())
+        {
+          m_transition_coefficients.push_back((boost::math::bernoulli_b2n<T>(k) * m_transition_am) * m_transition_one_over_two_k_fact);
+
+          m_transition_one_over_two_k_fact /= (two_k + 1);
+          m_transition_one_over_two_k_fact /= (two_k + 2);
+
+          ++m_transition_mk;
+          m_transition_am *= m_transition_mk;
+          ++m_transition_mk;
+          m_transition_am *= m_transition_mk;
+        }
+
+        const T term = m_transition_coefficients[kk] * one_over_z_plus_N_pow_minus_m_minus_two_k;
+
+        sum1 += term;
+
+        one_over_z_plus_N_pow_minus_m_minus_two_k *= one_over_z_plus_N_squared;
+      }
+
+      const T pg = (((sum0 + term0) + term1) + sum1) * m_transition_fact;
+
+      const bool b_negate = ((m % 2) == 0);
+
+      return ((!b_negate) ? pg : -pg);
+    }
+
+    // See polygamma_atinfinityplus: the coefficients are
+    // B2k / (2k)! (2k + n - 1)!, up to the first B2k / (2k)! to underflow.
+    T atinfinityplus(const T& x)
+    {
+      BOOST_MATH_STD_USING
+
+      const T nn = T(m_n);
+
+      if(!m_infinity_ready)
+      {
+        m_n_minus_one_fact = boost::math::factorial<T>(m_n - 1);
+
+        m_infinity_two_k_plus_n_minus_one      = nn + T(1);
+        m_infinity_two_k_plus_n_minus_one_fact = (m_n_minus_one_fact * nn) * (m_n + 1);
+
+        m_infinity_scaled = share_bernoulli_scaled_numbers_cache<T>();
+        m_infinity_b2k    = m_infinity_scaled->over_factorial(101U);
+        m_infinity_end = 101U;
+
+        m_infinity_coefficients.push_back(T(0));
+        m_infinity_coefficients.push_back(m_infinity_b2k[1] * m_infinity_two_k_plus_n_minus_one_fact);
+
+        m_infinity_ready = true;
+      }
+
+      const bool b_negate = ((m_n % 2) == 0);
+
+      const T one_over_z                  = T(1) / x;
+      const T one_over_z2                 = one_over_z * one_over_z;
+      const T one_over_z_pow_n            = T(1) / pow(x, m_n);
+            T one_over_x_pow_two_k_plus_n = one_over_z_pow_n * one_over_z2;
+            T sum                         = m_infinity_coefficients[1U] * one_over_x_pow_two_k_plus_n;
+
+      const int terms = polygamma_asymptotic_term_count<T, Policy>(m_n, x);
+
+      for(int two_k = 4; two_k <= (2 * terms); two_k += 2)
+      {
+        const std::size_t k = static_cast<std::size_t>(two_k / 2);
+
+        if((k >= m_infinity_coefficients.size()) && (!extend_atinfinityplus(k)))
+        {
+          // B2k / (2k)! has underflowed, as will all that follow.
+          break;
+        }
+
+        one_over_x_pow_two_k_plus_n *= one_over_z2;
+
+        const T term = m_infinity_coefficients[k] * one_over_x_pow_two_k_plus_n;
+
+        sum += term;
+      }
+
+      sum += ((((m_n_minus_one_fact * (nn + (x * static_cast<boost::int32_t>(2)))) * one_over_z_pow_n) * one_over_z) / 2);
+
+      return ((!b_negate) ? sum : -sum);
+    }
+
+    bool extend_atinfinityplus(const std::size_t k)
+    {
+      if(k >= m_infinity_end)
+      {
+        m_infinity_end *= 2U;
+        m_infinity_b2k  = m_infinity_scaled->over_factorial(m_infinity_end);
+      }
+
+      if(m_infinity_b2k[k] == 0)
+      {
+        return false;
+      }
+
+      m_infinity_two_k_plus_n_minus_one_fact *= ++m_infinity_two_k_plus_n_minus_one;
+      m_infinity_two_k_plus_n_minus_one_fact *= ++m_infinity_two_k_plus_n_minus_one;
+
+      m_infinity_coefficients.push_back(m_infinity_b2k[k] * m_infinity_two_k_plus_n_minus_one_fact);
+
+      return true;
+    }
+
+    // See detail::digamma_attransitionplus.
+    T digamma_attransitionplus(const T& x)
+    {
+      T z(x);
+
+      const T shift = digamma_shift(z, Policy());
+
+      return digamma_atinfinityplus(z) - shift;
+    }
+
+    // See digamma_atinfinityplus: the coefficients are B2k / 2k, for as
+    // many k as B2k is finite in T.
+    T digamma_atinfinityplus(const T& x)
+    {
+      BOOST_MATH_STD_USING
+
+      if(m_digamma_coefficients.empty())
+      {
+        m_digamma_numbers = share_bernoulli_numbers_cache<T>();
+        m_digamma_end     = m_digamma_numbers->ensure_available(101U);
+        m_digamma_b2k     = m_digamma_numbers->ensure(m_digamma_end);
+
+        m_digamma_coefficients.push_back(T(0));
+      }
+
+      T z(x);
+      T log_z(log(z));
+      T one_over_2z= T(1) / (2 * z);
+      T sum(0);
+
+      const int terms = polygamma_asymptotic_term_count<T, Policy>(0, z);
+
+      for(int two_k = 2; two_k <= (2 * terms); two_k += 2)
+      {
+        const std::size_t k = static_cast<std::size_t>(two_k / 2);
+
+        if((k >= m_digamma_coefficients.size()) && (!extend_digamma(k)))
+        {
+          break;
+        }
+
+        T z_pow_two_k          = pow(z, static_cast<boost::int32_t>(two_k));
+        T one_over_z_pow_two_k = T(1) / z_pow_two_k;
+
+        T term = m_digamma_coefficients[k] * one_over_z_pow_two_k;
+
+        sum += term;
+      }
+
+      return (log_z - one_over_2z) - sum;
+    }
+
+    bool extend_digamma(const std::size_t k)
+    {
+      if(k >= m_digamma_end)
+      {
+        const std::size_t available = m_digamma_numbers->ensure_available((m_digamma_end * 3U) / 2U);
+
+        if(available <= k)
+        {
+          return false;
+        }
+
+        m_digamma_end = available;
+        m_digamma_b2k = m_digamma_numbers->ensure(m_digamma_end);
+      }
+
+      const int two_k = static_cast<int>(2U * k);
+
+      T one_over_two_k = T(1) / two_k;
+
+      m_digamma_coefficients.push_back(m_digamma_b2k[k] * one_over_two_k);
+
+      return true;
+    }
+
+    const int      m_n;
+
+    bool           m_nearzero_ready;
+    T              m_nearzero_n_fact;
+    T              m_nearzero_binomial;
+    T              m_nearzero_sum0;
+    std::vector<T> m_nearzero_pg;
+
+    bool           m_transition_ready;
+    T              m_transition_fact;
+    T              m_transition_one_over_two_k_fact;
+    int            m_transition_mk;
+    T              m_transition_am;
+    std::vector<T> m_transition_coefficients;
+
+    bool           m_infinity_ready;
+    // m_infinity_b2k and m_digamma_b2k point into the Bernoulli number
+    // caches from one call to the next, so the batch shares ownership of
+    // those caches: neither a release of the caches nor a later call that
+    // moves this thread to another cache may free them under it.
+    boost::shared_ptr<bernoulli_scaled_numbers_cache<T> > m_infinity_scaled;
+    const T*       m_infinity_b2k;
+    std::size_t    m_infinity_end;
+    T              m_n_minus_one_fact;
+    T              m_infinity_two_k_plus_n_minus_one;
+    T              m_infinity_two_k_plus_n_minus_one_fact;
+    std::vector<T> m_infinity_coefficients;
+
+    boost::shared_ptr<bernoulli_numbers_cache<T> > m_digamma_numbers;
+    const T*       m_digamma_b2k;
+    std::size_t    m_digamma_end;
+    std::vector<T> m_digamma_coefficients;
+  };
+
+  // A kernel for polygamma(n, x) over blocks of double (or float, promoted)
+  // arguments, in which every argument of a block takes the same path.
+  // The recurrence
+  //
+  //   psi(n, x) = psi(n, x + 1) + (-1)^(n+1) n! / x^(n+1)
+  //
+  // shifts each x to some z >= z0, beyond which a fixed number of terms of
+  // the asymptotic series
+  //
+  //   psi(n, z) ~ (-1)^(n+1) [ (n-1)! / z^n + n! / (2 z^(n+1)) + sum_k c_k / z^(2k+n) ],
+  //   c_k = B2k (2k+n-1)! / (2k)!,
+  //
+  // (or log(z) - 1 / 2z - sum_k B2k / (2k z^2k) for digamma) attains full
+  // precision. The shifts are masked rather than branched on, and the
+  // series is a polynomial of fixed degree, so the loops over a block have
+  // no data dependent exits. The coefficients and z0 depend only on n, and
+  // are found once per range.
+  template <class T>
+  class polygamma_shifted_asymptotic
+  {
+  public:
+    BOOST_STATIC_CONSTANT(std::size_t, block_size = 16U);
+    BOOST_STATIC_CONSTANT(int,         terms      = 10);
+
+    explicit polygamma_shifted_asymptotic(const int n) : m_n(n), m_usable(false)
+    {
+      BOOST_MATH_STD_USING
+
+      if((n < 0) || (n > static_cast<int>(max_factorial<T>::value) - ((2 * terms) + 1)))
+      {
+        // (2k + n - 1)! would overflow T.
+        return;
+      }
+
+      const T* b2k_over_two_k_fact = get_bernoulli_scaled_numbers_cache<T>().over_factorial(terms + 2);
+
+      // (2k + n - 1)!, from k = 1.
+      T fact = boost::math::factorial<T>(static_cast<unsigned>(n + 1));
+
+      for(int k = 1; k <= terms + 1; ++k)
+      {
+        if(k > 1)
+        {
+          fact *= ((2 * k) + n - 2);
+          fact *= ((2 * k) + n - 1);
+        }
+
+        const T c = b2k_over_two_k_fact[k] * fact;
+
+        if(k <= terms)
+        {
+          m_c[k - 1] = c;
+        }
+        else
+        {
+          // The first term left out must fall below eps / 4 relative to
+          // the leading term, (n - 1)! / z^n, or about 1 for digamma.
+          const T lead = ((n == 0) ? T(1) : boost::math::factorial<T>(static_cast<unsigned>(n - 1)));
+
+          m_z0 = ceil(pow(T((4 * fabs(c)) / (lead * boost::math::tools::epsilon<T>())), T(1) / ((2 * terms) + 2)));
+        }
+      }
+
+      m_n_fact           = boost::math::factorial<T>(static_cast<unsigned>(n));
+      m_n_minus_one_fact = ((n == 0) ? T(0) : boost::math::factorial<T>(static_cast<unsigned>(n - 1)));
+      m_x_max            = pow(boost::math::tools::max_value<T>(), T(1) / (n + 1)) / 2;
+      m_usable           = true;
+    }
+
+    // Whether the kernel can be used at all for this n.
+    bool usable() const { return m_usable; }
+
+    // Whether x is within the domain of the kernel: positive, and small
+    // enough that x^(n+1) is finite, or psi(n, x) would come out as zero
+    // long before it underflows.
+    bool accepts(const T& x) const
+    {
+      return ((x > 0) && (x <= m_x_max));
+    }
+
+    // Evaluate psi(n, x[i]) for the block_size arguments of x, all accepted.
+    void operator()(const T* x, T* result) const
+    {
+      BOOST_MATH_STD_USING
+
+      T z  [block_size];
+      T acc[block_size];
+
+      // Only as many shifts as the smallest argument of the block needs.
+      T x_min = x[0U];
+
+      for(std::size_t i = 0U; i < block_size; ++i)
+      {
+        z  [i] = x[i];
+        acc[i] = T(0);
+        x_min  = (std::min)(x_min, x[i]);
+      }
+
+      const int shifts = ((x_min < m_z0) ? static_cast<int>(ceil(m_z0 - x_min)) : 0);
+
+      for(int s = 0; s < shifts; ++s)
+      {
+        for(std::size_t i = 0U; i < block_size; ++i)
+        {
+          const T    p     = T(1) / power(z[i], m_n + 1);
+          const bool shift = (z[i] < m_z0);
+
+          acc[i] += (shift ? p : T(0));
+          z  [i] += (shift ? T(1) : T(0));
+        }
+      }
+
+      for(std::size_t i = 0U; i < block_size; ++i)
+      {
+        const T inv = T(1) / z[i];
+        const T w   = inv * inv;
+
+        T poly = m_c[terms - 1];
+
+        for(int k = terms - 2; k >= 0; --k)
+        {
+          poly = (poly * w) + m_c[k];
+        }
+
+        poly *= w;
+
+        if(m_n == 0)
+        {
+          result[i] = ((log(z[i]) - (inv / 2)) - poly) - acc[i];
+        }
+        else
+        {
+          const T inv_pow_n = T(1) / power(z[i], m_n);
+
+          const T sum = ((m_n_minus_one_fact + ((m_n_fact / 2) * inv)) + poly) * inv_pow_n + (m_n_fact * acc[i]);
+
+          result[i] = (((m_n % 2) != 0) ? sum : T(-sum));
+        }
+      }
+    }
+
+  private:
+    // b^e by binary powering, whose steps depend only on e, which is the
+    // same for the whole block.
+    static T power(T b, int e)
+    {
+      T r(1);
+
+      for( ; e != 0; e >>= 1)
+      {
+        if((e & 1) != 0)
+        {
+          r *= b;
+        }
+
+        b *= b;
+      }
+
+      return r;
+    }
+
+    const int m_n;
+    bool      m_usable;
+    T         m_c[terms];
+    T         m_z0;
+    T         m_x_max;
+    T         m_n_fact;
+    T         m_n_minus_one_fact;
+  };
+
+  // Write polygamma(n, x) to out for each x in [first, last): with
+  // polygamma_shifted_asymptotic for doubles, a block at a time, and
+  // with polygamma_batch otherwise and for arguments outside its domain.
+  template<class T, class ResultType, class Policy, class InputIterator, class OutputIterator>
+  OutputIterator polygamma_range_imp(const int n, InputIterator first, InputIterator last, OutputIterator out, const Policy& pol, const mpl::false_&)
+  {
+    polygamma_batch<T, Policy> batch(n, pol);
+
+    for( ; first != last; ++first)
+    {
+      *out = ResultType(batch(T(*first)));
+      ++out;
+    }
+
+    return out;
+  }
+
+  template<class T, class ResultType, class Policy, class InputIterator, class OutputIterator>
+  OutputIterator polygamma_range_imp(const int n, InputIterator first, InputIterator last, OutputIterator out, const Policy& pol, const mpl::true_&)
+  {
+    typedef polygamma_shifted_asymptotic<T> kernel_type;
+
+    const kernel_type kernel(n);
+
+    if(!kernel.usable())
+    {
+      return polygamma_range_imp<T, ResultType>(n, first, last, out, pol, mpl::false_());
+    }
+
+    polygamma_batch<T, Policy> batch(n, pol);
+
+    T    x       [kernel_type::block_size];
+    T    argument[kernel_type::block_size];
+    T    result  [kernel_type::block_size];
+    bool accepted[kernel_type::block_size];
+
+    while(first != last)
+    {
+      std::size_t count = 0U;
+
+      for( ; (first != last) && (count < kernel_type::block_size); ++first, ++count)
+      {
+        x       [count] = T(*first);
+        accepted[count] = kernel.accepts(x[count]);
+      }
+
+      // Pad a short final block, and stand in for the arguments that the
+      // kernel can't take, with a harmless value.
+      for(std::size_t i = 0U; i < kernel_type::block_size; ++i)
+      {
+        argument[i] = (((i < count) && accepted[i]) ? x[i] : T(1));
+      }
+
+      kernel(argument, result);
+
+      for(std::size_t i = 0U; i < count; ++i)
+      {
+        *out = ResultType(accepted[i] ? result[i] : batch(x[i]));
+        ++out;
+      }
+    }
+
+    return out;
+  }
+
+  // Set inverse_power[j] = 1 / y^j for j = 0, 1, ..., top. Where each
+  // power is to be inverted, y^j comes from pow as in the series above.
+  // Otherwise y^j is the product of two lower powers, so that its rounding
+  // error grows as log(j) rather than as j, and only y^top is inverted:
+  // the rest are 1 / y^top times y^(top - j). That costs a few roundings
+  // but saves all the other divisions, as long as y^top is within range.
+  template<class T>
+  void polygamma_inverse_powers(const T& y, std::vector<T>& power, std::vector<T>& inverse_power, const bool invert_each)
+  {
+    BOOST_MATH_STD_USING
+
+    const std::size_t top = power.size() - 1U;
+
+    if(!invert_each)
+    {
+      power[0U] = T(1);
+
+      for(std::size_t j = 1U; j <= top; ++j)
+      {
+        power[j] = ((j == 1U) ? y : T(power[j / 2U] * power[j - (j / 2U)]));
+      }
+
+      const T inverse_top = T(1) / power[top];
+
+      if(   (power[top]  >= boost::math::tools::min_value<T>())
+         && (power[top]  <= boost::math::tools::max_value<T>())
+         && (inverse_top >= boost::math::tools::min_value<T>()))
+      {
+        for(std::size_t j = 0U; j <= top; ++j)
+        {
+          inverse_power[j] = inverse_top * power[top - j];
+        }
+
+        return;
+      }
+    }
+
+    for(std::size_t j = 0U; j <= top; ++j)
+    {
+      inverse_power[j] = T(1) / pow(y, static_cast<boost::int32_t>(j));
+    }
+  }
+
+  // Write polygamma(m, x) to out for m = 0, 1, ..., n_max from a single
+  // Euler-Maclaurin summation shared by all the orders. With z = x + N,
+  //
+  //   psi(m, x) = (-1)^(m+1) m! [ sum_{k<N} 1 / (x + k)^(m+1) + 1 / 2z^(m+1) + 1 / m z^m
+  //                               + sum_j (B2j / (2j)!) (m + 1) ... (m + 2j - 1) / z^(2j+m) ],
+  //
+  //   psi(x)    = log(z) - 1 / 2z - sum_j B2j / (2j z^2j) - sum_{k<N} 1 / (x + k).
+  //
+  // N is chosen for n_max as polygamma_attransitionplus chooses it for a
+  // single order, so no order is summed nearer to x than it would be on
+  // its own. The powers of 1 / (x + k) and of 1 / z, and the terms
+  // B2j / ((2j)! z^2j), are found once and used by every order.
+  template<class T, class ResultType, class Policy, class OutputIterator>
+  OutputIterator polygamma_sequence_imp(const int n_max, const T& x, OutputIterator out, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING
+
+    if(!(x > 0))
+    {
+      // There is no shift up to the asymptotic region from here, so
+      // take the orders one at a time.
+      for(int m = 0; m <= n_max; ++m)
+      {
+        *out = ResultType(polygamma_imp(m, x, pol));
+        ++out;
+      }
+
+      return out;
+    }
+
+    if(n_max < 0)
+    {
+      return out;
+    }
+
+    const int d4d = static_cast<boost::int32_t>(0.4F * std::numeric_limits<T>::digits10);
+    const int N   = ((x > 400.0F) ? 0 : (d4d + (4 * n_max)));
+
+    const std::size_t orders = static_cast<std::size_t>(n_max) + 1U;
+
+    std::vector<T> power        (orders + 1U);
+    std::vector<T> inverse_power(orders + 1U);
+    std::vector<T> sum0         (orders, T(0));
+
+    // Smallest terms first.
+    for(int k = N - 1; k >= 0; --k)
+    {
+      // The first term leads for small x, so it is found more carefully.
+      polygamma_inverse_powers(T(x + k), power, inverse_power, (k == 0));
+
+      for(std::size_t m = 0U; m < orders; ++m)
+      {
+        sum0[m] += inverse_power[m + 1U];
+      }
+    }
+
+    const T z = x + N;
+
+    // From here on, inverse_power holds the powers of 1 / z.
+    polygamma_inverse_powers(z, power, inverse_power, true);
+
+    const T one_over_z_squared = T(1) / (z * z);
+
+    bernoulli_scaled_numbers_cache<T>& scaled = get_bernoulli_scaled_numbers_cache<T>();
+
+    std::size_t    bernoulli_count     = 101U;
+    const T*       b2k_over_two_k_fact = scaled.over_factorial(bernoulli_count);
+    std::vector<T> b2k_terms(1U, T(0));
+    T              one_over_z_pow_two_k(1);
+
+    for(int m = 0; m <= n_max; ++m)
+    {
+      // The sum over j, in which the term for order m is
+      // B2j / ((2j)! z^2j) times (m + 1) ... (m + 2j - 1).
+      T sum(0);
+      T am(m + 1);
+
+      const int terms = polygamma_asymptotic_term_count<T, Policy>(m, z);
+
+      for(int k = 1; k <= terms; ++k)
+      {
+        const std::size_t j = static_cast<std::size_t>(k);
+
+        if(j >= b2k_terms.size())
+        {
+          if(j >= bernoulli_count)
+          {
+            bernoulli_count     *= 2U;
+            b2k_over_two_k_fact  = scaled.over_factorial(bernoulli_count);
+          }
+
+          one_over_z_pow_two_k *= one_over_z_squared;
+
+          b2k_terms.push_back(b2k_over_two_k_fact[j] * one_over_z_pow_two_k);
+        }
+
+        sum += b2k_terms[j] * am;
+
+        am *= ((2 * k) + m);
+        am *= ((2 * k) + m + 1);
+      }
+
+      const std::size_t mm = static_cast<std::size_t>(m);
+
+      T pg;
+
+      if(m == 0)
+      {
+        pg = ((log(z) - (inverse_power[1U] / 2)) - sum) - sum0[0U];
+      }
+      else
+      {
+        const T pg_over_m_fact = ((sum0[mm] + (inverse_power[mm + 1U] / 2)) + (inverse_power[mm] / m)) + (inverse_power[mm] * sum);
+
+        pg = (((m % 2) != 0) ? T(pg_over_m_fact * boost::math::factorial<T>(static_cast<unsigned>(m)))
+                             : T(-(pg_over_m_fact * boost::math::factorial<T>(static_cast<unsigned>(m)))));
+      }
+
+      *out = ResultType(pg);
+      ++out;
+    }
+
+    return out;
+  }
+
 } } } // namespace boost::math::detail
 
 #endif // _BOOST_POLYGAMMA_DETAIL_2013_07_30_HPP_
@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2013 Nikhar Agrawal
+//  Copyright 2013 Christopher Kormanyos
+//  Copyright 2013 John Maddock
+//  Copyright 2013 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef _BOOST_ZETA_INTEGER_VALUES_2013_08_01_HPP_
+ #define _BOOST_ZETA_INTEGER_VALUES_2013_08_01_HPP_
+
+  #include <cmath>
+  #include <limits>
+  #include <boost/noncopyable.hpp>
+  #include <boost/shared_ptr.hpp>
+  #include <boost/detail/lightweight_mutex.hpp>
+  #include <boost/math/constants/constants.hpp>
+  #include <boost/math/special_functions/bernoulli.hpp>
+  #include <boost/math/special_functions/zeta.hpp>
+  #include <boost/math/tools/precision.hpp>
+  #include <boost/mpl/bool.hpp>
+
+  namespace boost { namespace math { namespace detail {
+
+  // zeta(m) at the integers m = 0, 1, 2, ..., for series that use many of
+  // them, such as that of polygamma near zero. The values depend only on T
+  // (and its precision), so they are kept once per type in the stores of
+  // the Bernoulli caches, sharing their locking and publication scheme.
+  //
+  // Once sum k^-m takes no more than a few hundred terms, that is for
+  // m >= digits / 6, the sum is taken directly. Below that, zeta(2n) comes
+  // from the Bernoulli numbers,
+  //
+  //   zeta(2n) = |B2n / (2n)!| (4 pi^2)^n / 2,
+  //
+  // with B2n / (2n)! from bernoulli_scaled_numbers_cache, and zeta(2n + 1)
+  // from boost::math::zeta. zeta has a pole at 1: entry 1 is zero, and
+  // must not be used.
+  template <class T>
+  class zeta_integer_values_cache : private boost::noncopyable
+  {
+  public:
+    typedef typename bernoulli_numbers_cache<T>::policy_type policy_type;
+
+    // Ensure that zeta(m) is available for all m in [0, count)
+    // and return a pointer to the first element, as for
+    // bernoulli_numbers_cache::ensure.
+    const T* values(const std::size_t count)
+    {
+      if(m_values.size() < count)
+      {
+        boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+
+        const std::size_t previous_size = m_values.size();
+
+        if(previous_size < count)
+        {
+          grow(previous_size, count);
+        }
+      }
+
+      return m_values.data();
+    }
+
+    // An estimate of the memory held by the entries.
+    std::size_t bytes() const
+    {
+      return m_values.size() * bernoulli_entry_bytes<T>();
+    }
+
+  private:
+    void grow(const std::size_t previous_size, const std::size_t count)
+    {
+      // Called with the mutex held.
+      BOOST_MATH_STD_USING
+
+      const std::size_t direct_min = static_cast<std::size_t>((boost::math::tools::digits<T>() + 5) / 6);
+
+      // Shared rather than borrowed: the odd entries call zeta, which may
+      // itself move this thread to another Bernoulli number cache.
+      boost::shared_ptr<bernoulli_scaled_numbers_cache<T> > scaled;
+
+      const T* b2n_over_two_n_fact = 0;
+
+      if((previous_size < direct_min) && (count > 2U))
+      {
+        scaled              = share_bernoulli_scaled_numbers_cache<T>();
+        b2n_over_two_n_fact = scaled->over_factorial(((std::min)(count, direct_min) / 2U) + 1U);
+      }
+
+      T* values = m_values.prepare(count);
+
+      for(std::size_t m = previous_size; m < count; ++m)
+      {
+        if(m < 2U)
+        {
+          values[m] = ((m == 0U) ? T(-boost::math::constants::half<T>()) : T(0));
+        }
+        else if(m >= direct_min)
+        {
+          values[m] = direct_sum(m);
+        }
+        else if((m % 2U) == 0U)
+        {
+          // (4 pi^2)^n = p 2^e by binary powering. 4 pi^2 is rounded once,
+          // where (2 pi)^2n would raise the rounding of 2 pi to twice the
+          // power.
+          long e      = 0;
+          long e_base = 0;
+          T    p(1);
+          T    base = bernoulli_normalize(T(boost::math::constants::pi_sqr<T>() * 4), e_base);
+
+          for(std::size_t n = m / 2U; n != 0U; n >>= 1)
+          {
+            if((n & 1U) != 0U)
+            {
+              e += e_base;
+              p  = bernoulli_normalize(T(p * base), e);
+            }
+
+            if(n > 1U)
+            {
+              e_base += e_base;
+              base    = bernoulli_normalize(T(base * base), e_base);
+            }
+          }
+
+          const T b = fabs(b2n_over_two_n_fact[m / 2U]);
+
+          values[m] = bernoulli_denormalize(T(b * p), e - 1L, policy_type());
+        }
+        else
+        {
+          values[m] = boost::math::zeta(T(static_cast<int>(m)), policy_type());
+        }
+      }
+
+      m_values.publish(values, count);
+    }
+
+    // 1 + (2^-m + 3^-m + ... + K^-m), where K is large enough that the rest,
+    // less than K^(1-m) / (m - 1), is below half an ulp. The terms are added
+    // smallest first, and 1 last, so that each rounding is that of a sum
+    // no larger than 2^-m.
+    static T direct_sum(const std::size_t m)
+    {
+      BOOST_MATH_STD_USING
+
+      const double      exponent = static_cast<double>(boost::math::tools::digits<T>() + 1) / static_cast<double>(m - 1U);
+      const std::size_t terms    = static_cast<std::size_t>(std::pow(2.0, exponent)) + 1U;
+
+      T sum(0);
+
+      for(std::size_t k = terms; k > 1U; --k)
+      {
+        sum += pow(T(k), -static_cast<int>(m));
+      }
+
+      return T(1) + sum;
+    }
+
+    bernoulli_published_storage<T>    m_values;
+    boost::detail::lightweight_mutex  m_mutex;
+  };
+
+  template <class T>
+  zeta_integer_values_cache<T>& get_zeta_integer_values_cache()
+  {
+    return get_bernoulli_cache_imp<zeta_integer_values_cache<T>, T>(mpl::bool_<std::numeric_limits<T>::is_specialized>());
+  }
+
+} } } // namespace boost::math::detail
+
+#endif // _BOOST_ZETA_INTEGER_VALUES_2013_08_01_HPP_
@@ -120,28 +120,11 @@ std::size_t highest_bernoulli_index()
 }
 
 template<class T>
-const T& zero()
+inline const T* stirling_table()
 {
-    static T z0(0);
-    return z0;
-}
-
-template<class T>
-const T& bernoulli_table(const boost::uint32_t n)
-{
-   static std::vector<T> bernoulli_b2n_data;
-
-   std::size_t previous_size=bernoulli_b2n_data.size();
-
-   if(highest_bernoulli_index<T>() > previous_size)
-   {
-       bernoulli_b2n_data.resize(highest_bernoulli_index<T>());
-       boost::math::bernoulli_b2n<T>(int(previous_size),
-                                     unsigned(highest_bernoulli_index<T>() - previous_size),
-                                     bernoulli_b2n_data.begin() + previous_size);
-   }
-
-   return ((n < bernoulli_b2n_data.size()) ? bernoulli_b2n_data[n] : zero<T>());
+   // The coefficients of Stirling's series, B2n / (2n (2n - 1)) for
+   // n < highest_bernoulli_index<T>(), in place in the per-type cache.
+   return boost::math::detail::get_bernoulli_scaled_numbers_cache<T>().stirling(highest_bernoulli_index<T>());
 }
 
 template <class T, class Policy>
@@ -181,18 +164,18 @@ T gamma_imp_bernoulli(T x, const Policy& pol)
     xx += n_recur;
   }
 
+  const T* stirling = stirling_table<T>();
+
         T one_over_x_pow_two_n_minus_one = 1 / xx;
   const T one_over_x2                    = one_over_x_pow_two_n_minus_one * one_over_x_pow_two_n_minus_one;
-        T sum                            = (bernoulli_table<T>(1) / static_cast<boost::int32_t>(2)) * one_over_x_pow_two_n_minus_one;
+        T sum                            = stirling[1] * one_over_x_pow_two_n_minus_one;
 
   // Perform the Bernoulli series expansion of Stirling's approximation.
   for(boost::int32_t n2 = static_cast<boost::int32_t>(4); n2 < static_cast<boost::int32_t>(highest_bernoulli_index<T>()); n2 += static_cast<boost::int32_t>(2))
   {
     one_over_x_pow_two_n_minus_one *= one_over_x2;
 
-    const T term = (bernoulli_table<T>(static_cast<boost::uint32_t>(n2 / 2)) * one_over_x_pow_two_n_minus_one) / static_cast<boost::int32_t>(n2 * (n2 - static_cast<boost::int32_t>(1)));
-
-    sum += term;
+    sum += stirling[n2 / 2] * one_over_x_pow_two_n_minus_one;
   }
 
   static const T half_ln_two_pi = log(boost::math::constants::two_pi<T>()) / static_cast<boost::int32_t>(2);
@@ -234,18 +217,18 @@ T lgamma_imp_bernoulli(T z, const Policy& pol)
 
   T xx(z);
 
+  const T* stirling = stirling_table<T>();
+
         T one_over_x_pow_two_n_minus_one = 1 / xx;
   const T one_over_x2                    = one_over_x_pow_two_n_minus_one * one_over_x_pow_two_n_minus_one;
-        T sum                            = (bernoulli_table<T>(1) / static_cast<boost::int32_t>(2)) * one_over_x_pow_two_n_minus_one;
+        T sum                            = stirling[1] * one_over_x_pow_two_n_minus_one;
 
   // Perform the Bernoulli series expansion of Stirling's approximation.
   for(boost::int32_t n2 = static_cast<boost::int32_t>(4); n2 < static_cast<boost::int32_t>(highest_bernoulli_index<T>()); n2 += static_cast<boost::int32_t>(2))
   {
     one_over_x_pow_two_n_minus_one *= one_over_x2;
 
-    const T term = (bernoulli_table<T>(static_cast<boost::uint32_t>(n2 / 2)) * one_over_x_pow_two_n_minus_one) / static_cast<boost::int32_t>(n2 * (n2 - static_cast<boost::int32_t>(1)));
-
-    sum += term;
+    sum += stirling[n2 / 2] * one_over_x_pow_two_n_minus_one;
   }
 
   static const T half_ln_two_pi = log(boost::math::constants::two_pi<T>()) / static_cast<boost::int32_t>(2);
@@ -28,6 +28,7 @@
 #include <boost/math/policies/policy.hpp>
 #include <boost/mpl/comparison.hpp>
 #include <boost/config/no_tr1/complex.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #define BOOST_NO_MACRO_EXPAND /**/
 
@@ -567,6 +568,37 @@ namespace boost
                                       unsigned number_of_bernoullis_b2n,
                                       OutputIterator out_it);
 
+   template <class T, class Policy>
+   boost::iterator_range<const T*> bernoulli_b2n_view(int start_index,
+                                                      unsigned number_of_bernoullis_b2n,
+                                                      const Policy& pol);
+
+   template <class T>
+   boost::iterator_range<const T*> bernoulli_b2n_view(int start_index,
+                                                      unsigned number_of_bernoullis_b2n);
+
+   template <class T>
+   std::size_t bernoulli_b2n_cache_file(const char* filename);
+
+   template <class T, class Policy>
+   void bernoulli_b2n_reserve(const int max_index, const Policy& pol);
+
+   template <class T>
+   void bernoulli_b2n_reserve(const int max_index);
+
+   template <class T, class Policy>
+   void bernoulli_b2n_parallel_reserve(const int max_index, const unsigned thread_count, const Policy& pol);
+
+   template <class T>
+   void bernoulli_b2n_parallel_reserve(const int max_index, const unsigned thread_count);
+
+   template <class T>
+   std::size_t bernoulli_b2n_max_index();
+
+   inline void bernoulli_b2n_release_caches();
+
+   inline std::size_t bernoulli_b2n_set_cache_budget(const std::size_t bytes);
+
    namespace detail{
 
       typedef mpl::int_<0> bessel_no_int_tag;      // No integer optimisation possible.
@@ -1225,6 +1257,18 @@ namespace boost
    inline OutputIterator bernoulli_b2n(int start_index,\
                                       unsigned number_of_bernoullis_b2n,\
                                       OutputIterator out_it);\
+\
+   template <class T>\
+   inline boost::iterator_range<const T*> bernoulli_b2n_view(int start_index, unsigned number_of_bernoullis_b2n)\
+   { return boost::math::bernoulli_b2n_view<T>(start_index, number_of_bernoullis_b2n, Policy()); }\
+\
+   template <class T>\
+   inline void bernoulli_b2n_reserve(const int max_index)\
+   { boost::math::bernoulli_b2n_reserve<T>(max_index, Policy()); }\
+\
+   template <class T>\
+   inline void bernoulli_b2n_parallel_reserve(const int max_index, const unsigned thread_count)\
+   { boost::math::bernoulli_b2n_parallel_reserve<T>(max_index, thread_count, Policy()); }\
 \
    template <class T1, class T2>\
    inline typename boost::math::detail::bessel_traits<T1, T2, Policy >::result_type cyl_bessel_j(T1 v, T2 x)\
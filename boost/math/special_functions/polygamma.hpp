@@ -11,9 +11,13 @@
 #ifndef _BOOST_POLYGAMMA_2013_07_30_HPP_
   #define _BOOST_POLYGAMMA_2013_07_30_HPP_
 
+  #include <iterator>
+  #include <limits>
   #include <boost/array.hpp>
   #include <boost/cstdint.hpp>
   #include <boost/math/special_functions/factorials.hpp>
+  #include <boost/mpl/bool.hpp>
+  #include <boost/type_traits/is_floating_point.hpp>
   #include "detail/polygamma.hpp"
 
   namespace boost { namespace math {
@@ -47,6 +51,45 @@
       return boost::math::polygamma(n,x,policies::policy<>());
   }
 
+  // Write polygamma(n, x) to out for each x in [first, last), and return the
+  // end of the output. The work that depends only on n is done once for
+  // the whole range, rather than once per x, and float and double arguments
+  // are evaluated in blocks by a kernel without data dependent branches.
+  template<class InputIterator, class OutputIterator, class Policy>
+  inline OutputIterator polygamma(const int n, InputIterator first, InputIterator last, OutputIterator out, const Policy &pol)
+  {
+      typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+      typedef typename promoteftod<value_type>::type                   result_type;
+
+      typedef mpl::bool_<   is_floating_point<result_type>::value
+                         && (std::numeric_limits<result_type>::digits <= 53)> tag_type;
+
+      return boost::math::detail::polygamma_range_imp<result_type, value_type>(n, first, last, out, pol, tag_type());
+  }
+
+  template<class InputIterator, class OutputIterator>
+  inline OutputIterator polygamma(const int n, InputIterator first, InputIterator last, OutputIterator out)
+  {
+      return boost::math::polygamma(n,first,last,out,policies::policy<>());
+  }
+
+  // Write polygamma(m, x) to out for m = 0, 1, ..., n_max, and return the
+  // end of the output. The orders share one summation, so that all of
+  // them cost little more than polygamma(n_max, x) alone.
+  template<class T, class OutputIterator, class Policy>
+  inline OutputIterator polygamma_sequence(const int n_max, T x, OutputIterator out, const Policy &pol)
+  {
+      typedef typename promoteftod<T>::type result_type;
+
+      return boost::math::detail::polygamma_sequence_imp<result_type, T>(n_max, result_type(x), out, pol);
+  }
+
+  template<class T, class OutputIterator>
+  inline OutputIterator polygamma_sequence(const int n_max, T x, OutputIterator out)
+  {
+      return boost::math::polygamma_sequence(n_max,x,out,policies::policy<>());
+  }
+
   template<class T, class Policy>
   inline T digamma(T x, const Policy &pol)
   {
@@ -71,6 +114,30 @@
       return boost::math::trigamma(x,policies::policy<>());
   }
 
+  template<class InputIterator, class OutputIterator, class Policy>
+  inline OutputIterator digamma(InputIterator first, InputIterator last, OutputIterator out, const Policy &pol)
+  {
+      return boost::math::polygamma(0,first,last,out,pol);
+  }
+
+  template<class InputIterator, class OutputIterator>
+  inline OutputIterator digamma(InputIterator first, InputIterator last, OutputIterator out)
+  {
+      return boost::math::digamma(first,last,out,policies::policy<>());
+  }
+
+  template<class InputIterator, class OutputIterator, class Policy>
+  inline OutputIterator trigamma(InputIterator first, InputIterator last, OutputIterator out, const Policy &pol)
+  {
+      return boost::math::polygamma(1,first,last,out,pol);
+  }
+
+  template<class InputIterator, class OutputIterator>
+  inline OutputIterator trigamma(InputIterator first, InputIterator last, OutputIterator out)
+  {
+      return boost::math::trigamma(first,last,out,policies::policy<>());
+  }
+
 
 } } // namespace boost::math
 
@@ -0,0 +1,651 @@
+#define BOOST_TEST_MAIN
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <thread>
+#endif
+
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<25>, boost::multiprecision::et_off> cpp_bin_float_25_noet;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<30>, boost::multiprecision::et_off> cpp_bin_float_30_noet;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<40>, boost::multiprecision::et_off> cpp_bin_float_40_noet;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<100>, boost::multiprecision::et_off> cpp_bin_float_100_noet;
+
+// Pairs of types with the same arithmetic and precision, but separate
+// caches: neither rounds its entries from the other, which is no more
+// precise.
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<35>, boost::multiprecision::et_off> cpp_bin_float_35_noet;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<35>, boost::multiprecision::et_on>  cpp_bin_float_35_et;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<50>, boost::multiprecision::et_off> cpp_bin_float_50_noet;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<50>, boost::multiprecision::et_on>  cpp_bin_float_50_et;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<45>, boost::multiprecision::et_off> cpp_bin_float_45_noet;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<45>, boost::multiprecision::et_on>  cpp_bin_float_45_et;
+
+// Quad precision, with the exponent range of the 113-bit table, and with a
+// wider one, for which the last finite index is estimated instead.
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<113, boost::multiprecision::digit_base_2, void, boost::int16_t, -16382, 16383>, boost::multiprecision::et_off> cpp_bin_float_quad_noet;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<113, boost::multiprecision::digit_base_2, void, boost::int32_t, -20000, 20000>, boost::multiprecision::et_off> cpp_bin_float_quad_wide_noet;
+
+// 100 bits, with an exponent range that ends past the rational table, and
+// with one wide enough for every B2n finite in the first. Both ranges are
+// narrower than that of the quad types, whose caches would otherwise be
+// rounded into theirs.
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<100, boost::multiprecision::digit_base_2, void, boost::int32_t, -5000, 5000>, boost::multiprecision::et_off> cpp_bin_float_narrow_noet;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<100, boost::multiprecision::digit_base_2, void, boost::int32_t, -10000, 10000>, boost::multiprecision::et_off> cpp_bin_float_narrow_wide_noet;
+
+typedef boost::math::policies::policy<boost::math::policies::overflow_error<boost::math::policies::ignore_error> > ignore_overflow_policy;
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+
+void read_bernoulli_numbers(std::vector<cpp_bin_float_25_noet>* values)
+{
+   // Scalar reads, each growing the cache a little, then a read of the
+   // whole range.
+   for(std::size_t i = 0; i < values->size(); i += 10)
+   {
+      (*values)[i] = boost::math::bernoulli_b2n<cpp_bin_float_25_noet>(static_cast<int>(i));
+   }
+
+   boost::math::bernoulli_b2n<cpp_bin_float_25_noet>(0, static_cast<unsigned>(values->size()), values->begin());
+}
+
+// Threads that grow the cache of one type at the same time, reading
+// entries that another thread may be publishing, must all see the same
+// values as a single thread does afterwards.
+void test_threads()
+{
+   std::cout << "Testing concurrent reads of the Bernoulli cache:\n";
+
+   static const unsigned thread_count = 4U;
+   static const int      max_index    = 400;
+
+   std::vector<std::vector<cpp_bin_float_25_noet> > values(thread_count);
+   std::vector<std::thread>                         threads;
+
+   for(unsigned t = 0; t < thread_count; ++t)
+   {
+      values[t].resize(max_index + 1 - (50 * t));
+      threads.push_back(std::thread(read_bernoulli_numbers, &values[t]));
+   }
+
+   for(unsigned t = 0; t < thread_count; ++t)
+   {
+      threads[t].join();
+   }
+
+   for(unsigned t = 0; t < thread_count; ++t)
+   {
+      for(std::size_t i = 0; i < values[t].size(); ++i)
+      {
+         BOOST_CHECK_EQUAL(values[t][i], boost::math::bernoulli_b2n<cpp_bin_float_25_noet>(static_cast<int>(i)));
+      }
+   }
+}
+
+#endif
+
+// bernoulli_b2n, its series form and the cache hold the same values,
+// whatever the policy of the caller. Past the last finite entry, each
+// caller raises its own overflow error.
+void test_shared()
+{
+   std::cout << "Testing the Bernoulli cache shared by all entry points:\n";
+
+   const int max_index = boost::math::detail::max_bernoulli_index<double>::value;
+
+   std::vector<double> series(max_index + 11);
+
+   boost::math::bernoulli_b2n<double>(0, static_cast<unsigned>(series.size()), series.begin(), ignore_overflow_policy());
+
+   const double* cached = boost::math::detail::get_bernoulli_numbers_cache<double>().ensure(series.size());
+
+   for(int i = 0; i <= max_index; ++i)
+   {
+      BOOST_CHECK_EQUAL(series[i], boost::math::bernoulli_b2n<double>(i));
+      BOOST_CHECK_EQUAL(cached[i], series[i]);
+   }
+
+   for(int i = max_index + 1; i < static_cast<int>(series.size()); ++i)
+   {
+      BOOST_CHECK((boost::math::isinf)(series[i]));
+      BOOST_CHECK_EQUAL(series[i], boost::math::bernoulli_b2n<double>(i, ignore_overflow_policy()));
+      BOOST_CHECK_THROW(boost::math::bernoulli_b2n<double>(i), std::overflow_error);
+   }
+
+   BOOST_CHECK_THROW(boost::math::bernoulli_b2n<double>(max_index - 2, 4U, series.begin()), std::overflow_error);
+}
+
+// A cache grown a few entries at a time, resuming the tangent number
+// recurrence where it stopped, holds the very values of one grown at once.
+void test_growth()
+{
+   std::cout << "Testing step-wise growth of the Bernoulli cache:\n";
+
+   static const int max_index = 600;
+
+   std::vector<cpp_bin_float_35_et> at_once(max_index + 1);
+
+   boost::math::bernoulli_b2n<cpp_bin_float_35_et>(0, max_index + 1, at_once.begin());
+
+   for(int i = 0; i <= max_index; i += 3)
+   {
+      BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n<cpp_bin_float_35_noet>(i), cpp_bin_float_35_noet(at_once[i]));
+   }
+
+   for(int i = 0; i <= max_index; ++i)
+   {
+      BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n<cpp_bin_float_35_noet>(i), cpp_bin_float_35_noet(at_once[i]));
+   }
+}
+
+// The tangent number triangle spread over several threads must give the
+// very values of the serial recurrence, well past the rational table.
+void test_parallel_reserve()
+{
+   std::cout << "Testing bernoulli_b2n_parallel_reserve:\n";
+
+   static const int max_index = 700;
+
+   boost::math::bernoulli_b2n_parallel_reserve<cpp_bin_float_50_noet>(max_index, 4U);
+   boost::math::bernoulli_b2n_reserve<cpp_bin_float_50_et>(max_index);
+
+   std::vector<cpp_bin_float_50_noet> parallel(max_index + 1);
+   std::vector<cpp_bin_float_50_et>   serial  (max_index + 1);
+
+   boost::math::bernoulli_b2n<cpp_bin_float_50_noet>(0, max_index + 1, parallel.begin());
+   boost::math::bernoulli_b2n<cpp_bin_float_50_et>  (0, max_index + 1, serial.begin());
+
+   for(int i = 0; i <= max_index; ++i)
+   {
+      BOOST_CHECK_EQUAL(parallel[i], cpp_bin_float_50_noet(serial[i]));
+   }
+
+   // Growing the cache again in parallel, from where it stopped, leaves
+   // the entries already there.
+   boost::math::bernoulli_b2n_parallel_reserve<cpp_bin_float_50_noet>(2 * max_index, 0U);
+   boost::math::bernoulli_b2n_reserve<cpp_bin_float_50_et>(2 * max_index);
+
+   BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n<cpp_bin_float_50_noet>(2 * max_index),
+                     cpp_bin_float_50_noet(boost::math::bernoulli_b2n<cpp_bin_float_50_et>(2 * max_index)));
+   BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n<cpp_bin_float_50_noet>(max_index), parallel[max_index]);
+}
+
+// A view refers to the cached values themselves: it must hold what
+// bernoulli_b2n returns, and stay so as the cache grows past it.
+template <class T>
+void test_view(const char* name, const int last_index)
+{
+   std::cout << "Testing bernoulli_b2n_view for type " << name << ":\n";
+
+   const boost::iterator_range<const T*> head = boost::math::bernoulli_b2n_view<T>(0, 20U);
+
+   BOOST_CHECK_EQUAL(head.size(), 20);
+
+   for(int i = 0; i < 20; ++i)
+   {
+      BOOST_CHECK_EQUAL(head[i], boost::math::bernoulli_b2n<T>(i));
+   }
+
+   // Asking for more than is cached grows the cache first.
+   const int start = last_index / 2;
+   const boost::iterator_range<const T*> tail = boost::math::bernoulli_b2n_view<T>(start, static_cast<unsigned>(last_index - start + 1));
+
+   BOOST_CHECK_EQUAL(tail.size(), last_index - start + 1);
+
+   for(int i = start; i <= last_index; ++i)
+   {
+      BOOST_CHECK_EQUAL(tail[i - start], boost::math::bernoulli_b2n<T>(i));
+   }
+
+   for(int i = 0; i < 20; ++i)
+   {
+      BOOST_CHECK_EQUAL(head[i], boost::math::bernoulli_b2n<T>(i));
+   }
+
+   BOOST_CHECK(boost::math::bernoulli_b2n_view<T>(start, 0U).empty());
+}
+
+template <class T>
+std::vector<T> read_cache_file(const std::string& filename)
+{
+   std::vector<T> values;
+   boost::math::detail::bernoulli_cache_file_read(filename, values);
+   return values;
+}
+
+std::vector<std::string> read_lines(const std::string& filename)
+{
+   std::ifstream is(filename.c_str());
+
+   std::vector<std::string> lines;
+   std::string line;
+
+   while(std::getline(is, line))
+   {
+      lines.push_back(line);
+   }
+
+   return lines;
+}
+
+void write_lines(const std::string& filename, const std::vector<std::string>& lines, const std::size_t count, const std::string& tail = std::string())
+{
+   std::ofstream os(filename.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+
+   for(std::size_t i = 0; i < count; ++i)
+   {
+      os << lines[i] << '\n';
+   }
+
+   os << tail;
+}
+
+// A cache file written by hand is loaded as it is, a file written by the
+// cache reads back exactly, and a damaged file yields the entries before
+// the first damaged line. T must not have been used before: a cache loads
+// only the entries past those it already holds.
+template <class T>
+void test_cache_file(const char* name, const int max_index)
+{
+   std::cout << "Testing bernoulli_b2n_cache_file for type " << name << ":\n";
+
+   const std::string filename = std::string("test_bernoulli_cache_") + name + ".txt";
+   const std::string damaged  = std::string("test_bernoulli_cache_") + name + "_damaged.txt";
+
+   std::remove(filename.c_str());
+
+   // Entries from the compiled-in table, one of them altered so that it
+   // can only have come from the file.
+   static const int file_size = 16;
+   static const int altered   = 7;
+
+   std::vector<T> table(file_size);
+
+   for(int i = 0; i < file_size; ++i)
+   {
+      table[i] = boost::math::detail::unchecked_bernoulli_b2n<T>(i);
+   }
+
+   table[altered] *= 1 + boost::math::tools::epsilon<T>() * 4;
+
+   boost::math::detail::bernoulli_cache_file_append(filename, &table[0], 0U, table.size());
+
+   // Lines for another type are skipped.
+   const double other[2] = { 1, 0.5 };
+   boost::math::detail::bernoulli_cache_file_append(filename, other, 0U, 2U);
+
+   BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n_cache_file<T>(filename.c_str()), static_cast<std::size_t>(file_size));
+
+   for(int i = 0; i < file_size; ++i)
+   {
+      BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n<T>(i), table[i]);
+   }
+
+   // Growing the cache past the file, which catches up with the loaded
+   // entries first, appends the new entries to the file.
+   boost::math::bernoulli_b2n_reserve<T>(max_index);
+
+   const std::vector<T> values = read_cache_file<T>(filename);
+
+   BOOST_CHECK_EQUAL(values.size(), static_cast<std::size_t>(max_index + 1));
+
+   for(int i = 0; (i <= max_index) && (i < static_cast<int>(values.size())); ++i)
+   {
+      BOOST_CHECK_EQUAL(values[i], boost::math::bernoulli_b2n<T>(i));
+   }
+
+   // The entries past the file are computed afresh, unaffected by the
+   // altered one.
+   BOOST_CHECK_CLOSE_FRACTION(boost::math::bernoulli_b2n<T>(max_index),
+                              boost::math::bernoulli_b2n<cpp_bin_float_50_noet>(max_index).template convert_to<T>(),
+                              boost::math::tools::epsilon<T>() * 10);
+
+   const std::vector<std::string> lines = read_lines(filename);
+
+   BOOST_CHECK_EQUAL(lines.size(), static_cast<std::size_t>(max_index + 1 + 2));
+
+   // The file holds index 0 to file_size - 1, the two lines for double,
+   // then the rest: the line at index file_size + 3 is the fourth after.
+   const std::size_t damaged_line  = file_size + 2 + 3;
+   const std::size_t damaged_index = file_size + 3;
+
+   // A digit changed: the checksum no longer matches.
+   std::vector<std::string> changed(lines);
+   const std::size_t digit = changed[damaged_line].find_first_of("123456789", changed[damaged_line].find(' ', changed[damaged_line].find(' ') + 1));
+
+   changed[damaged_line][digit] = (changed[damaged_line][digit] == '9') ? '8' : '9';
+
+   write_lines(damaged, changed, changed.size());
+   BOOST_CHECK_EQUAL(read_cache_file<T>(damaged).size(), damaged_index);
+
+   // A later valid line for the same index makes up for it.
+   changed.push_back(lines[damaged_line]);
+
+   write_lines(damaged, changed, changed.size());
+   BOOST_CHECK_EQUAL(read_cache_file<T>(damaged).size(), static_cast<std::size_t>(max_index + 1));
+
+   // Nor does the order of the lines matter.
+   const std::vector<std::string> reversed(lines.rbegin(), lines.rend());
+
+   write_lines(damaged, reversed, reversed.size());
+   BOOST_CHECK_EQUAL(read_cache_file<T>(damaged).size(), static_cast<std::size_t>(max_index + 1));
+
+   // Cut off in the middle of a line, as by a crashed writer.
+   write_lines(damaged, lines, damaged_line, lines[damaged_line].substr(0, lines[damaged_line].size() / 2));
+   BOOST_CHECK_EQUAL(read_cache_file<T>(damaged).size(), damaged_index);
+
+   // Attaching the cache to the truncated file loads what is there, and
+   // appends the entries that the file lacks.
+   BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n_cache_file<T>(damaged.c_str()), damaged_index);
+
+   const std::vector<T> repaired = read_cache_file<T>(damaged);
+
+   BOOST_CHECK_EQUAL(repaired.size(), static_cast<std::size_t>(max_index + 1));
+
+   for(int i = 0; (i <= max_index) && (i < static_cast<int>(repaired.size())); ++i)
+   {
+      BOOST_CHECK_EQUAL(repaired[i], boost::math::bernoulli_b2n<T>(i));
+   }
+
+   // A file that does not exist yet holds nothing.
+   std::remove(damaged.c_str());
+   BOOST_CHECK(read_cache_file<T>(damaged).empty());
+
+   std::remove(filename.c_str());
+}
+
+// Past the rational table, the cache of a multiprecision type rounds the
+// entries of a cache with more digits: they must be those entries rounded
+// once, and agree with the values that the tangent number recurrence gives
+// without a donor, to the error of the recurrence. None of the types may
+// have been used before, nor any type with more than 48 digits.
+void test_donor()
+{
+   std::cout << "Testing Bernoulli caches filled from a more precise cache:\n";
+
+   static const int max_index = 600;
+
+   boost::math::bernoulli_b2n_reserve<cpp_bin_float_45_et>(max_index);
+   boost::math::bernoulli_b2n_reserve<cpp_bin_float_100_noet>(max_index);
+   boost::math::bernoulli_b2n_reserve<cpp_bin_float_45_noet>(max_index);
+
+   const cpp_bin_float_45_noet tol = boost::math::tools::epsilon<cpp_bin_float_45_noet>() * 20;
+
+   for(int i = boost::math::detail::max_bernoulli_index<cpp_bin_float_45_noet>::value + 1; i <= max_index; ++i)
+   {
+      const cpp_bin_float_45_noet rounded(boost::math::bernoulli_b2n<cpp_bin_float_100_noet>(i));
+
+      BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n<cpp_bin_float_45_noet>(i), rounded);
+      BOOST_CHECK_CLOSE_FRACTION(cpp_bin_float_45_noet(boost::math::bernoulli_b2n<cpp_bin_float_45_et>(i)), rounded, tol);
+   }
+}
+
+// bernoulli_b2n_reserve fills the cache up to max_index at once, and no
+// further, with the values that bernoulli_b2n would have computed. T must
+// not have been used before.
+template <class T>
+void test_reserve(const char* name, const int max_index)
+{
+   std::cout << "Testing bernoulli_b2n_reserve for type " << name << ":\n";
+
+   const boost::math::detail::bernoulli_numbers_cache<T>& cache = boost::math::detail::get_bernoulli_numbers_cache<T>();
+
+   BOOST_CHECK_EQUAL(cache.size(), 0U);
+
+   boost::math::bernoulli_b2n_reserve<T>(max_index);
+
+   BOOST_CHECK_EQUAL(cache.size(), static_cast<std::size_t>(max_index + 1));
+
+   const T tol = boost::math::tools::epsilon<T>() * 10;
+
+   for(int i = 0; i <= max_index; i += 7)
+   {
+      BOOST_CHECK_CLOSE_FRACTION(boost::math::bernoulli_b2n<T>(i), boost::math::bernoulli_b2n<cpp_bin_float_50_noet>(i).template convert_to<T>(), tol);
+   }
+
+   BOOST_CHECK_CLOSE_FRACTION(boost::math::bernoulli_b2n<T>(max_index), boost::math::bernoulli_b2n<cpp_bin_float_50_noet>(max_index).template convert_to<T>(), tol);
+
+   // Reading the reserved entries, or reserving fewer, leaves the cache as it is.
+   boost::math::bernoulli_b2n_reserve<T>(max_index / 2);
+
+   BOOST_CHECK_EQUAL(cache.size(), static_cast<std::size_t>(max_index + 1));
+
+   BOOST_CHECK_THROW(boost::math::bernoulli_b2n_reserve<T>(-1), std::domain_error);
+}
+
+// B2n / (2n)! and B2n / (2n (2n - 1)) are B2n divided out at a higher
+// precision, up to the error of the scaling, including past the index at
+// which B2n overflows T, where the error grows like n eps.
+template <class T>
+void test_scaled(const char* name, const int max_index)
+{
+   using std::fabs;
+
+   std::cout << "Testing the scaled Bernoulli numbers for type " << name << ":\n";
+
+   boost::math::detail::bernoulli_scaled_numbers_cache<T>& cache = boost::math::detail::get_bernoulli_scaled_numbers_cache<T>();
+
+   const T* over_factorial = cache.over_factorial(max_index + 1);
+   const T* stirling       = cache.stirling(max_index + 1);
+
+   BOOST_CHECK_EQUAL(over_factorial[0], 1);
+   BOOST_CHECK_EQUAL(stirling[0], 0);
+
+   cpp_bin_float_50_noet fact(1);
+
+   for(int i = 1; i <= max_index; ++i)
+   {
+      const cpp_bin_float_50_noet two_n_two_n_minus_one = (2 * i) * ((2 * i) - 1);
+
+      fact *= two_n_two_n_minus_one;
+
+      const cpp_bin_float_50_noet b = boost::math::bernoulli_b2n<cpp_bin_float_50_noet>(i);
+
+      const T tol = boost::math::tools::epsilon<T>() * (10 + i);
+
+      const T expected_over_factorial = (b / fact).template convert_to<T>();
+      const T expected_stirling       = (b / two_n_two_n_minus_one).template convert_to<T>();
+
+      // Denormal or zero once B2n / (2n)! is below the range of T, and
+      // infinite once B2n / (2n (2n - 1)) is above it.
+      if(fabs(expected_over_factorial) >= boost::math::tools::min_value<T>())
+      {
+         BOOST_CHECK_CLOSE_FRACTION(over_factorial[i], expected_over_factorial, tol);
+      }
+
+      if((boost::math::isfinite)(expected_stirling))
+      {
+         BOOST_CHECK_CLOSE_FRACTION(stirling[i], expected_stirling, tol);
+      }
+      else
+      {
+         BOOST_CHECK((boost::math::isinf)(stirling[i]));
+      }
+   }
+}
+
+// The caches of types with a fixed precision are not released: views and
+// pointers into them remain valid, and nothing is computed again.
+template <class T>
+void test_release(const char* name, const int max_index)
+{
+   std::cout << "Testing bernoulli_b2n_release_caches for type " << name << ":\n";
+
+   const boost::iterator_range<const T*> view = boost::math::bernoulli_b2n_view<T>(0, static_cast<unsigned>(max_index + 1));
+
+   const boost::math::detail::bernoulli_numbers_cache<T>& cache = boost::math::detail::get_bernoulli_numbers_cache<T>();
+   const std::size_t size = cache.size();
+
+   boost::math::bernoulli_b2n_release_caches();
+
+   BOOST_CHECK(&boost::math::detail::get_bernoulli_numbers_cache<T>() == &cache);
+   BOOST_CHECK_EQUAL(cache.size(), size);
+
+   for(int i = 0; i <= max_index; ++i)
+   {
+      BOOST_CHECK_EQUAL(view[i], boost::math::bernoulli_b2n<T>(i));
+   }
+}
+
+// bernoulli_b2n_max_index is the last index at which B2n is finite: exactly
+// so for the types whose table runs to the end of their range, and at most
+// one too large for the others.
+template <class T>
+void test_max_index(const char* name, const bool exact)
+{
+   std::cout << "Testing bernoulli_b2n_max_index for type " << name << ":\n";
+
+   const int max_index = static_cast<int>(boost::math::bernoulli_b2n_max_index<T>());
+
+   BOOST_CHECK((boost::math::isfinite)(boost::math::bernoulli_b2n<T>(max_index - 1)));
+
+   if(exact)
+   {
+      BOOST_CHECK((boost::math::isfinite)(boost::math::bernoulli_b2n<T>(max_index)));
+   }
+
+   BOOST_CHECK_THROW(boost::math::bernoulli_b2n<T>(max_index + 1), std::overflow_error);
+}
+
+// The tangent numbers are generated straight into the destination when it
+// is a pointer, and through a buffer for other output iterators: both give
+// the values of a single serial pass, and so does growing the Bernoulli
+// numbers in place a chunk at a time.
+void test_in_place()
+{
+   std::cout << "Testing Bernoulli numbers generated in place:\n";
+
+   static const std::size_t count = 500;
+
+   const boost::math::policies::policy<> pol;
+
+   std::vector<cpp_bin_float_35_noet> tangent(count);
+   std::deque<cpp_bin_float_35_noet>  tangent_inserted;
+
+   boost::math::detail::tangent_numbers_generator<cpp_bin_float_35_noet> serial;
+   boost::math::detail::tangent_numbers_generator<cpp_bin_float_35_noet> parallel;
+
+   serial.generate(0U, count, &tangent[0], pol);
+   parallel.generate(0U, count, std::back_inserter(tangent_inserted), pol, 4U);
+
+   BOOST_CHECK_EQUAL(tangent_inserted.size(), count);
+
+   for(std::size_t i = 0; (i < count) && (i < tangent_inserted.size()); ++i)
+   {
+      BOOST_CHECK_EQUAL(tangent_inserted[i], tangent[i]);
+   }
+
+   std::vector<cpp_bin_float_35_noet> bn(count);
+
+   boost::math::detail::tangent_numbers_generator<cpp_bin_float_35_noet> generator;
+
+   for(std::size_t start = 0U, chunk = 1U; start < count; start += chunk, chunk += 17U)
+   {
+      boost::math::detail::tangent_numbers_series(&bn[start], generator, start, (std::min)(chunk, count - start), pol, 4U);
+   }
+
+   // The cache holds the rational table's values up to its last index.
+   for(std::size_t i = boost::math::detail::max_bernoulli_index<cpp_bin_float_35_noet>::value + 1U; i < count; ++i)
+   {
+      BOOST_CHECK_EQUAL(bn[i], boost::math::bernoulli_b2n<cpp_bin_float_35_noet>(static_cast<int>(i)));
+   }
+}
+
+// Only the last rows of the tangent number triangle before T overflows are
+// evaluated with overflow checks: up to the last finite entry of a type
+// with a narrow exponent range, the Bernoulli numbers must be those of the
+// same precision with a wide one, and past it they overflow.
+void test_overflow_edge()
+{
+   std::cout << "Testing Bernoulli numbers at the end of a narrow exponent range:\n";
+
+   const int max_index = static_cast<int>(boost::math::bernoulli_b2n_max_index<cpp_bin_float_narrow_noet>());
+
+   BOOST_CHECK(max_index > boost::math::detail::max_bernoulli_index<cpp_bin_float_narrow_noet>::value);
+
+   for(int i = 0; i < max_index; ++i)
+   {
+      BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n<cpp_bin_float_narrow_noet>(i),
+                        cpp_bin_float_narrow_noet(boost::math::bernoulli_b2n<cpp_bin_float_narrow_wide_noet>(i)));
+   }
+
+   BOOST_CHECK_THROW(boost::math::bernoulli_b2n<cpp_bin_float_narrow_noet>(max_index + 1), std::overflow_error);
+}
+
+// Past a table that runs to the end of the range of T, the cache holds the
+// overflow values, of alternating sign, from the entry after the table's.
+template <class T>
+void test_past_table(const char* name)
+{
+   std::cout << "Testing the Bernoulli cache past the table for type " << name << ":\n";
+
+   boost::math::detail::bernoulli_numbers_cache<T>& cache = boost::math::detail::get_bernoulli_numbers_cache<T>();
+
+   const std::size_t last = boost::math::detail::max_bernoulli_index<T>::value;
+   const T*          bn   = cache.ensure(last + 21U);
+
+   BOOST_CHECK_EQUAL(cache.overflow_index(), last + 1U);
+
+   for(std::size_t i = last + 1U; i <= last + 20U; ++i)
+   {
+      BOOST_CHECK((boost::math::isinf)(bn[i]));
+      BOOST_CHECK_EQUAL(bn[i] > 0, (i % 2U) != 0U);
+   }
+}
+
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+   test_threads();
+#endif
+
+   test_shared();
+
+   test_growth();
+
+   test_donor();
+
+   test_cache_file<float>("float", static_cast<int>(boost::math::bernoulli_b2n_max_index<float>()));
+   test_cache_file<cpp_bin_float_30_noet>("cpp_bin_float_30", 400);
+
+   test_parallel_reserve();
+
+   test_view<double>("double", 120);
+   test_view<long double>("long double", 1000);
+   test_view<cpp_bin_float_50_noet>("cpp_bin_float_50", 800);
+
+   test_reserve<cpp_bin_float_40_noet>("cpp_bin_float_40", 500);
+
+   test_release<double>("double", 120);
+   test_release<cpp_bin_float_50_noet>("cpp_bin_float_50", 800);
+
+   test_max_index<float>("float", true);
+   test_max_index<double>("double", true);
+   test_max_index<long double>("long double", true);
+   test_max_index<cpp_bin_float_quad_noet>("cpp_bin_float_quad", true);
+   test_max_index<cpp_bin_float_quad_wide_noet>("cpp_bin_float_quad with a wider exponent range", false);
+
+   test_scaled<double>("double", 220);
+   test_scaled<long double>("long double", 1600);
+
+   test_in_place();
+
+   test_overflow_edge();
+
+   test_past_table<float>("float");
+   test_past_table<double>("double");
+   test_past_table<long double>("long double");
+}
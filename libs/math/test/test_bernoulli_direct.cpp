@@ -0,0 +1,57 @@
+#define BOOST_TEST_MAIN
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+// Two types with the same arithmetic and precision, but separate caches.
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<50>, boost::multiprecision::et_off> cpp_bin_float_50_noet;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<50>, boost::multiprecision::et_on>  cpp_bin_float_50_et;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<100>, boost::multiprecision::et_off> cpp_bin_float_100_noet;
+
+typedef boost::math::policies::policy<boost::math::policies::digits10<40> > digits10_40_policy;
+
+// A single B2n far beyond the cache, to fewer digits than T holds, is taken
+// from zeta(2n) rather than from the tangent numbers: the cache is left as it
+// is, and the value agrees with the one the cache would hold.
+void test_direct()
+{
+   std::cout << "Testing the direct evaluation of single Bernoulli numbers:\n";
+
+   static const int index = 700;
+
+   const digits10_40_policy pol;
+
+   BOOST_CHECK( boost::math::detail::bernoulli_use_direct_imp<cpp_bin_float_50_noet>(index, 0U, pol));
+   BOOST_CHECK(!boost::math::detail::bernoulli_use_direct_imp<cpp_bin_float_50_noet>(index, 0U, boost::math::policies::policy<>()));
+   BOOST_CHECK(!boost::math::detail::bernoulli_use_direct_imp<cpp_bin_float_50_noet>(index, index, pol));
+   BOOST_CHECK(!boost::math::detail::bernoulli_use_direct_imp<cpp_bin_float_50_noet>(BOOST_MATH_BERNOULLI_DIRECT_MIN_INDEX - 1, 0U, pol));
+
+   const std::size_t cache_size = boost::math::detail::get_bernoulli_numbers_cache<cpp_bin_float_50_noet>().size();
+
+   const cpp_bin_float_50_noet direct = boost::math::bernoulli_b2n<cpp_bin_float_50_noet>(index, pol);
+
+   BOOST_CHECK_EQUAL(boost::math::detail::get_bernoulli_numbers_cache<cpp_bin_float_50_noet>().size(), cache_size);
+
+   // log2(4n) bits are lost to the rounding error of 2 pi: 12 here.
+   const cpp_bin_float_50_noet tol = ldexp(boost::math::tools::epsilon<cpp_bin_float_50_noet>(), 12);
+
+   BOOST_CHECK_CLOSE_FRACTION(direct, cpp_bin_float_50_noet(boost::math::bernoulli_b2n<cpp_bin_float_50_et>(index)), tol);
+
+   // Far past the reach of the cache, against the same evaluation with
+   // twice the digits.
+   static const int far_index = 20000;
+
+   BOOST_CHECK_CLOSE_FRACTION(boost::math::bernoulli_b2n<cpp_bin_float_50_noet>(far_index, pol),
+                              cpp_bin_float_50_noet(boost::math::detail::bernoulli_b2n_direct_imp<cpp_bin_float_100_noet>(far_index, boost::math::policies::policy<>())),
+                              ldexp(boost::math::tools::epsilon<cpp_bin_float_50_noet>(), 17));
+
+   BOOST_CHECK_EQUAL(boost::math::detail::get_bernoulli_numbers_cache<cpp_bin_float_50_noet>().size(), cache_size);
+}
+
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_direct();
+}
@@ -0,0 +1,52 @@
+#define BOOST_TEST_MAIN
+#define BOOST_MATH_BERNOULLI_EXACT_TANGENT_NUMBERS
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <vector>
+
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<50>, boost::multiprecision::et_off>  cpp_bin_float_50_noet;
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<100>, boost::multiprecision::et_off> cpp_bin_float_100_noet;
+
+// With exact tangent numbers, every multiprecision type rounds B2n from
+// the one table of cpp_int: the entries of two precisions agree to within
+// the rounding of the lower, however far past the compiled-in tables.
+void test_exact()
+{
+   std::cout << "Testing Bernoulli numbers from exact tangent numbers:\n";
+
+   static const int max_index = 700;
+
+   std::vector<cpp_bin_float_50_noet>  low (max_index + 1);
+   std::vector<cpp_bin_float_100_noet> high(max_index + 1);
+
+   boost::math::bernoulli_b2n<cpp_bin_float_50_noet> (0, max_index + 1, low.begin());
+   boost::math::bernoulli_b2n<cpp_bin_float_100_noet>(0, max_index + 1, high.begin());
+
+   const cpp_bin_float_50_noet tol = boost::math::tools::epsilon<cpp_bin_float_50_noet>();
+
+   for(int i = 0; i <= max_index; ++i)
+   {
+      BOOST_CHECK_CLOSE_FRACTION(low[i], cpp_bin_float_50_noet(high[i]), tol);
+   }
+
+   // T_1 ... T_5 are 1, 2, 16, 272 and 7936.
+   typedef boost::math::detail::tangent_numbers_master_table::value_type value_type;
+
+   const value_type* tangent_numbers = boost::math::detail::get_tangent_numbers_master_table().ensure(6U);
+
+   BOOST_CHECK_EQUAL(tangent_numbers[0], value_type(0));
+   BOOST_CHECK_EQUAL(tangent_numbers[1], value_type(1));
+   BOOST_CHECK_EQUAL(tangent_numbers[2], value_type(2));
+   BOOST_CHECK_EQUAL(tangent_numbers[3], value_type(16));
+   BOOST_CHECK_EQUAL(tangent_numbers[4], value_type(272));
+   BOOST_CHECK_EQUAL(tangent_numbers[5], value_type(7936));
+}
+
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_exact();
+}
@@ -0,0 +1,175 @@
+#define BOOST_TEST_MAIN
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/mpfr.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+// Just over 100 decimal digits: enough for a reference at 100 digits,
+// without being precise enough to fill that cache by rounding its own.
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<102>, boost::multiprecision::et_off> reference_type;
+
+// For a type whose precision is set at run time, each precision has a cache
+// of its own: the values must be accurate at the current precision, however
+// the precision has changed since, and a cache is kept for when the program
+// returns to its precision. Past the small table such types start from, the
+// tangent number recurrence loses an eps or so every hundred rows, but
+// values left over from another precision would be far further out.
+template <class T>
+void test(const char* name)
+{
+   std::cout << "Testing type " << name << ":\n";
+
+   static const unsigned precisions[] = { 30, 100, 30, 50, 100 };
+   static const int      indices[]    = { 1, 12, 60, 200, 400, 700 };
+
+   const unsigned default_precision = T::default_precision();
+
+   const boost::math::detail::bernoulli_numbers_cache<T>* cache_30 = 0;
+   std::size_t                                               size_30  = 0;
+
+   for(unsigned i = 0; i < sizeof(precisions) / sizeof(precisions[0]); ++i)
+   {
+      T::default_precision(precisions[i]);
+
+      const T tol = boost::math::tools::epsilon<T>() * 50;
+
+      for(unsigned j = 0; j < sizeof(indices) / sizeof(indices[0]); ++j)
+      {
+         const T reference(boost::math::bernoulli_b2n<reference_type>(indices[j]).str(0, std::ios_base::scientific));
+
+         BOOST_CHECK_CLOSE_FRACTION(boost::math::bernoulli_b2n<T>(indices[j]), reference, tol);
+      }
+
+      const boost::math::detail::bernoulli_numbers_cache<T>& cache = boost::math::detail::get_bernoulli_numbers_cache<T>();
+
+      if(precisions[i] == 30)
+      {
+         if(cache_30)
+         {
+            // Back at 30 digits, the entries computed before are still there.
+            BOOST_CHECK(&cache == cache_30);
+            BOOST_CHECK_EQUAL(cache.size(), size_30);
+         }
+
+         cache_30 = &cache;
+         size_30  = cache.size();
+      }
+      else
+      {
+         BOOST_CHECK(&cache != cache_30);
+      }
+   }
+
+   T::default_precision(default_precision);
+}
+
+// Releasing the caches loses no values: they are rebuilt on demand, while
+// a share of a cache taken earlier, and a view, keep theirs as they were.
+template <class T>
+void test_release(const char* name, const unsigned precision, const int max_index)
+{
+   std::cout << "Testing bernoulli_b2n_release_caches for type " << name << ":\n";
+
+   const unsigned default_precision = T::default_precision();
+
+   T::default_precision(precision);
+
+   std::vector<T> before(max_index + 1);
+   boost::math::bernoulli_b2n<T>(0, max_index + 1, before.begin());
+
+   const boost::shared_ptr<boost::math::detail::bernoulli_numbers_cache<T> > shared = boost::math::detail::share_bernoulli_numbers_cache<T>();
+   const std::size_t shared_size = shared->size();
+
+   const boost::iterator_range<const T*> view = boost::math::bernoulli_b2n_view<T>(0, static_cast<unsigned>(max_index + 1));
+
+   boost::math::bernoulli_b2n_release_caches();
+
+#ifdef BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+   const boost::math::detail::bernoulli_numbers_cache<T>& cache = boost::math::detail::get_bernoulli_numbers_cache<T>();
+
+   BOOST_CHECK(&cache != shared.get());
+   BOOST_CHECK_EQUAL(cache.size(), 0U);
+#endif
+
+   BOOST_CHECK_EQUAL(shared->size(), shared_size);
+
+   std::vector<T> after(max_index + 1);
+   boost::math::bernoulli_b2n<T>(0, max_index + 1, after.begin());
+
+   for(int i = 0; i <= max_index; ++i)
+   {
+      BOOST_CHECK_EQUAL(after[i], before[i]);
+      BOOST_CHECK_EQUAL(view[i], before[i]);
+      BOOST_CHECK_EQUAL(shared->ensure(max_index + 1)[i], before[i]);
+   }
+
+   T::default_precision(default_precision);
+}
+
+#ifdef BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+
+// Over the budget, the least recently used caches that no thread holds are
+// released as soon as a thread moves to another cache: here this thread
+// moves from the cache at one precision to that at another, and the first
+// goes.
+template <class T>
+void test_cache_budget(const char* name)
+{
+   std::cout << "Testing bernoulli_b2n_set_cache_budget for type " << name << ":\n";
+
+   static const int max_index = 350;
+
+   const unsigned default_precision = T::default_precision();
+
+   std::vector<T> values_35(max_index + 1);
+   std::vector<T> values_45(max_index + 1);
+
+   T::default_precision(35);
+   boost::math::bernoulli_b2n<T>(0, max_index + 1, values_35.begin());
+
+   const std::size_t default_budget = boost::math::bernoulli_b2n_set_cache_budget(1U);
+
+   BOOST_CHECK_EQUAL(default_budget, static_cast<std::size_t>(BOOST_MATH_BERNOULLI_CACHE_BYTES));
+
+   T::default_precision(45);
+   boost::math::bernoulli_b2n<T>(0, max_index + 1, values_45.begin());
+
+   BOOST_CHECK_EQUAL(boost::math::detail::get_bernoulli_numbers_cache<T>().size(), static_cast<std::size_t>(max_index + 1));
+
+   // Back at 35 digits, the cache starts afresh, and is rebuilt with the
+   // very same values.
+   T::default_precision(35);
+
+   BOOST_CHECK_EQUAL(boost::math::detail::get_bernoulli_numbers_cache<T>().size(), 0U);
+
+   std::vector<T> rebuilt(max_index + 1);
+   boost::math::bernoulli_b2n<T>(0, max_index + 1, rebuilt.begin());
+
+   for(int i = 0; i <= max_index; ++i)
+   {
+      BOOST_CHECK_EQUAL(rebuilt[i], values_35[i]);
+   }
+
+   BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n_set_cache_budget(default_budget), 1U);
+
+   T::default_precision(default_precision);
+}
+
+#endif
+
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test<boost::multiprecision::mpfr_float>("mpfr_float");
+
+   test_release<boost::multiprecision::mpfr_float>("mpfr_float", 60, 300);
+
+#ifdef BOOST_MATH_BERNOULLI_HAS_THREAD_LOCAL
+   test_cache_budget<boost::multiprecision::mpfr_float>("mpfr_float");
+#endif
+}
@@ -0,0 +1,237 @@
+#define BOOST_TEST_MAIN
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<50>, boost::multiprecision::et_off> cpp_bin_float_50_noet;
+
+// Read in constant expressions, where the compiler supports C++14 constexpr.
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+
+static_assert(boost::math::detail::unchecked_bernoulli_b2n<float>(0) == 1, "B0");
+static_assert(boost::math::detail::unchecked_bernoulli_b2n<float>(1) * 6 == 1, "B2");
+static_assert(boost::math::detail::unchecked_bernoulli_b2n<float>(31) > 2E36F, "B62");
+
+static_assert(boost::math::detail::unchecked_bernoulli_b2n<double>(0) == 1, "B0");
+static_assert(boost::math::detail::unchecked_bernoulli_b2n<double>(2) * -30 == 1, "B4");
+static_assert(boost::math::detail::unchecked_bernoulli_b2n<double>(129) > 1E306, "B258");
+
+static_assert(boost::math::detail::unchecked_bernoulli_b2n<long double>(0) == 1, "B0");
+static_assert(boost::math::detail::unchecked_bernoulli_b2n<long double>(6) * 2730 == -691, "B12");
+static_assert(boost::math::detail::unchecked_bernoulli_b2n<long double>(1) > 0, "B2");
+
+#endif
+
+// The same entries at run time, where the compiler lacks C++14 constexpr.
+void test_known_values()
+{
+   std::cout << "Testing known values of the compiled-in tables:\n";
+
+   BOOST_CHECK_EQUAL(boost::math::detail::unchecked_bernoulli_b2n<float>(0), 1);
+   BOOST_CHECK_EQUAL(boost::math::detail::unchecked_bernoulli_b2n<float>(1) * 6, 1);
+   BOOST_CHECK_GT(boost::math::detail::unchecked_bernoulli_b2n<float>(31), 2E36F);
+
+   BOOST_CHECK_EQUAL(boost::math::detail::unchecked_bernoulli_b2n<double>(0), 1);
+   BOOST_CHECK_EQUAL(boost::math::detail::unchecked_bernoulli_b2n<double>(2) * -30, 1);
+   BOOST_CHECK_GT(boost::math::detail::unchecked_bernoulli_b2n<double>(129), 1E306);
+
+   BOOST_CHECK_EQUAL(boost::math::detail::unchecked_bernoulli_b2n<long double>(0), 1);
+   BOOST_CHECK_EQUAL(boost::math::detail::unchecked_bernoulli_b2n<long double>(6) * 2730, -691);
+   BOOST_CHECK_GT(boost::math::detail::unchecked_bernoulli_b2n<long double>(1), 0);
+}
+
+// The entries of the compiled-in tables, as far as the exact rationals go,
+// are B2n correctly rounded to T.
+template <class T>
+void test_table(const char* name)
+{
+   std::cout << "Testing the compiled-in table for type " << name << ":\n";
+
+   const std::size_t last = (std::min)(static_cast<std::size_t>(boost::math::detail::max_bernoulli_index<T>::value), static_cast<std::size_t>(309U));
+
+   typedef boost::multiprecision::cpp_rational rational_type;
+
+   for(std::size_t i = 0; i <= last; ++i)
+   {
+      const rational_type exact(rational_type(boost::math::detail::bernoulli_rational_data<>::entries[i].numerator)
+                                / rational_type(boost::math::detail::bernoulli_rational_data<>::entries[i].denominator));
+
+      BOOST_CHECK_EQUAL(boost::math::detail::unchecked_bernoulli_b2n<T>(i), exact.template convert_to<T>());
+   }
+}
+
+// Types with the exponent range of 80-bit and quad precision take the
+// 113-bit table, which runs up to B2312, the last B2n below 2^16384. Its
+// entries agree with B2n from the tangent numbers at 50 digits to within
+// the rounding to T.
+template <class T>
+void test_quad_table(const char* name)
+{
+   std::cout << "Testing the 113-bit table for type " << name << ":\n";
+
+   BOOST_CHECK_EQUAL(static_cast<int>(boost::math::detail::bernoulli_imp_variant<T>::value), 4);
+   BOOST_CHECK_EQUAL(static_cast<unsigned>(boost::math::detail::max_bernoulli_index<T>::value), 1156U);
+
+   const T tol = boost::math::tools::epsilon<T>();
+
+   for(unsigned i = 0U; i <= boost::math::detail::max_bernoulli_index<T>::value; ++i)
+   {
+      const T reference = static_cast<T>(boost::math::bernoulli_b2n<cpp_bin_float_50_noet>(i));
+
+      BOOST_CHECK_CLOSE_FRACTION(boost::math::detail::unchecked_bernoulli_b2n<T>(i), reference, tol);
+      BOOST_CHECK_EQUAL(boost::math::bernoulli_b2n<T>(i), boost::math::detail::unchecked_bernoulli_b2n<T>(i));
+   }
+}
+
+// B_m modulo p, for m = 0 ... max_m, from sum_{k=0}^{m} C(m+1, k) B_k = 0:
+// independent of the tangent numbers from which the tables were generated.
+std::vector<boost::uint64_t> bernoulli_modulo(const boost::uint64_t p, const unsigned max_m)
+{
+   std::vector<boost::uint64_t> b(max_m + 1U);
+   std::vector<boost::uint64_t> binomial(1U, 1U); // C(m+1, k), k = 0 ... m+1
+
+   b[0] = 1U;
+
+   for(unsigned m = 1U; m <= max_m; ++m)
+   {
+      // From row m of Pascal's triangle to row m + 1.
+      binomial.push_back(1U);
+
+      for(unsigned k = m; k > 0U; --k)
+      {
+         binomial[k] = (binomial[k] + binomial[k - 1U]) % p;
+      }
+
+      if(binomial.size() == 2U)
+      {
+         binomial.push_back(1U);
+         binomial[1] = 2U;
+      }
+
+      boost::uint64_t sum = 0U;
+
+      for(unsigned k = 0U; k < m; ++k)
+      {
+         sum = (sum + binomial[k] * b[k]) % p;
+      }
+
+      // B_m = -sum / (m + 1), dividing by Fermat's little theorem.
+      boost::uint64_t inverse = 1U;
+      boost::uint64_t base    = (m + 1U) % p;
+
+      for(boost::uint64_t e = p - 2U; e != 0U; e >>= 1)
+      {
+         if((e & 1U) != 0U)
+         {
+            inverse = (inverse * base) % p;
+         }
+
+         base = (base * base) % p;
+      }
+
+      b[m] = ((p - sum) % p * inverse) % p;
+   }
+
+   return b;
+}
+
+bool is_prime(const unsigned n)
+{
+   for(unsigned d = 2U; d * d <= n; ++d)
+   {
+      if((n % d) == 0U)
+      {
+         return false;
+      }
+   }
+
+   return (n > 1U);
+}
+
+// The exact rationals of the multiprecision types: each fraction is in lowest
+// terms with the denominator of von Staudt and Clausen, the product of the
+// primes p with (p - 1) | 2n, and its numerator is right modulo a few primes.
+void test_rational_data()
+{
+   std::cout << "Testing the exact rational table:\n";
+
+   typedef boost::multiprecision::cpp_int int_type;
+
+   const unsigned last = 309U;
+
+   static const boost::uint64_t primes[] = { 2147483647U, 2147483629U, 1000000007U };
+
+   std::vector<std::vector<boost::uint64_t> > residues;
+
+   for(unsigned j = 0U; j < sizeof(primes) / sizeof(primes[0]); ++j)
+   {
+      residues.push_back(bernoulli_modulo(primes[j], 2U * last));
+   }
+
+   BOOST_CHECK_EQUAL(int_type(boost::math::detail::bernoulli_rational_data<>::entries[0].numerator), 1);
+   BOOST_CHECK_EQUAL(int_type(boost::math::detail::bernoulli_rational_data<>::entries[0].denominator), 1);
+
+   for(unsigned n = 1U; n <= last; ++n)
+   {
+      const int_type numerator  (boost::math::detail::bernoulli_rational_data<>::entries[n].numerator);
+      const int_type denominator(boost::math::detail::bernoulli_rational_data<>::entries[n].denominator);
+
+      int_type staudt_clausen = 1;
+
+      for(unsigned d = 1U; d <= 2U * n; ++d)
+      {
+         if((((2U * n) % d) == 0U) && is_prime(d + 1U))
+         {
+            staudt_clausen *= (d + 1U);
+         }
+      }
+
+      BOOST_CHECK_EQUAL(denominator, staudt_clausen);
+      BOOST_CHECK_EQUAL(gcd(numerator, denominator), 1);
+
+      // B2n has the sign of (-1)^(n+1).
+      BOOST_CHECK_EQUAL(numerator > 0, (n % 2U) != 0U);
+
+      for(unsigned j = 0U; j < residues.size(); ++j)
+      {
+         const boost::uint64_t p = primes[j];
+
+         const boost::uint64_t num = (((numerator % p) + p) % p).convert_to<boost::uint64_t>();
+         const boost::uint64_t den = (denominator % p).convert_to<boost::uint64_t>();
+
+         BOOST_CHECK_EQUAL((residues[j][2U * n] * den) % p, num);
+      }
+   }
+
+   // A few well known values.
+   BOOST_CHECK_EQUAL(int_type(boost::math::detail::bernoulli_rational_data<>::entries[6].numerator), -691);
+   BOOST_CHECK_EQUAL(int_type(boost::math::detail::bernoulli_rational_data<>::entries[6].denominator), 2730);
+   BOOST_CHECK_EQUAL(int_type(boost::math::detail::bernoulli_rational_data<>::entries[20].numerator), int_type("-261082718496449122051"));
+   BOOST_CHECK_EQUAL(int_type(boost::math::detail::bernoulli_rational_data<>::entries[20].denominator), 13530);
+}
+
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_known_values();
+
+   test_rational_data();
+
+   test_table<float>("float");
+   test_table<double>("double");
+   test_table<long double>("long double");
+   test_table<boost::multiprecision::cpp_bin_float_quad>("cpp_bin_float_quad");
+
+   if(std::numeric_limits<long double>::max_exponent == 16384)
+   {
+      test_quad_table<long double>("long double");
+   }
+
+   test_quad_table<boost::multiprecision::cpp_bin_float_quad>("cpp_bin_float_quad");
+}
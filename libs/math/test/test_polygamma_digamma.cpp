@@ -0,0 +1,61 @@
+#define BOOST_TEST_MAIN
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/math/special_functions/polygamma.hpp>
+#include <stdexcept>
+
+#define SC_(x) static_cast<T>(BOOST_JOIN(x, L))
+
+// polygamma(0, x), that is digamma, on both sides of zero and either side
+// of the switch to the asymptotic series at 400, with a pole at each
+// non-positive integer.
+template <class T>
+void test(const char* name)
+{
+   std::cout << "Testing type " << name << ":\n";
+
+   /* From psi(1/4), psi(1/2), psi(3/4) and psi(1) in closed form, the
+      recurrence, and psi(1 - x) - psi(x) = pi cot(pi x). */
+   static const T x[] =
+   {
+      SC_(-20.25), SC_(-2.5), SC_(-0.75), SC_(0.25), SC_(0.5), SC_(1.0), SC_(3.0), SC_(7.25), SC_(50.5), SC_(399.5), SC_(400.5), SC_(1000.0)
+   };
+
+   static const T data[] =
+   {
+      SC_(6.1742356336144837691691346431746005830682e+0),
+      SC_(1.1031566406452431872256903336679110994735e+0),
+      SC_(-2.8941202000429320747561968127633502440339e+0),
+      SC_(-4.2274535333762654080895301460966835773672e+0),
+      SC_(-1.9635100260214234794409763329987555671932e+0),
+      SC_(-5.7721566490153286060651209008240243104216e-1),
+      SC_(9.2278433509846713939348790991759756895784e-1),
+      SC_(1.9104535268837360283824945612221413885165e+0),
+      SC_(3.9120396709283919846087872253529816566542e+0),
+      SC_(5.9889616786132249000919092627803660067970e+0),
+      SC_(5.9914648075243638237464774730431945424666e+0),
+      SC_(6.9072551956488120520500061142514977454795e+0)
+   };
+
+   static const unsigned table_size = sizeof(x) / sizeof(x[0]);
+
+   const T tol = boost::math::tools::epsilon<T>() * 10;
+
+   for(unsigned i = 0; i < table_size; ++i)
+   {
+      BOOST_CHECK_CLOSE_FRACTION(boost::math::polygamma(0, x[i]), data[i], tol);
+   }
+
+   BOOST_CHECK_THROW(boost::math::polygamma(0, SC_(0.0)), std::domain_error);
+   BOOST_CHECK_THROW(boost::math::polygamma(0, SC_(-1.0)), std::domain_error);
+   BOOST_CHECK_THROW(boost::math::polygamma(0, SC_(-7.0)), std::domain_error);
+}
+
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test<float>("float");
+   test<double>("double");
+   test<long double>("long double");
+}
@@ -0,0 +1,63 @@
+#define BOOST_TEST_MAIN
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/math/special_functions/polygamma.hpp>
+
+#define SC_(x) static_cast<T>(BOOST_JOIN(x, L))
+
+// polygamma(n, x) for |x| < 1/2 and orders large enough that (k + n)!
+// overflows double long before the series near zero has converged.
+template <class T>
+void test(const char* name)
+{
+   std::cout << "Testing type " << name << ":\n";
+
+   /* N[Table[PolyGamma[n, x], {{n, x}, ...}], 40] */
+   static const int n[] =
+   {
+      24, 31, 40, 50, 60, 80, 100, 31, 52, 101, 7, 2
+   };
+
+   static const T x[] =
+   {
+      SC_(0.46875), SC_(0.4375), SC_(0.4375), SC_(0.4375), SC_(0.3125), SC_(0.109375), SC_(0.25),
+      SC_(-0.3125), SC_(-0.4375), SC_(-0.4375), SC_(-0.46875), SC_(0.001953125)
+   };
+
+   static const T data[] =
+   {
+      SC_(-104513803200937725033997054154939.9194539),
+      SC_(2.533517644754952579811349237494762825379e+45),
+      SC_(-4.280994959240794389737550349286240720929e+62),
+      SC_(-6.211463637970250618427465006216479147609e+82),
+      SC_(-5.424048034326346918839609250931134719359e+112),
+      SC_(-5.039232241853175173561693082161968024665e+196),
+      SC_(-5.99877784494339162434730974655741513722e+218),
+      SC_(1.201769215672139662368983823262341216044e+50),
+      SC_(8.606184239766105368625311164420077752343e+86),
+      SC_(3.931544339492594988121192903465575049621e+196),
+      SC_(2956791.581754874774370982480831007549219),
+      SC_(-268435458.3914776465528798866228039798)
+   };
+
+   static const unsigned table_size = sizeof(n) / sizeof(n[0]);
+
+   T tol = boost::math::tools::epsilon<T>() * 10;
+   for(unsigned i = 0; i < table_size; ++i)
+   {
+      T pg = boost::math::polygamma(n[i], x[i]);
+      BOOST_CHECK_CLOSE_FRACTION(pg, data[i], tol);
+
+      T range_pg;
+      boost::math::polygamma(n[i], &x[i], &x[i] + 1, &range_pg);
+      BOOST_CHECK_CLOSE_FRACTION(range_pg, data[i], tol);
+   }
+}
+
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test<double>("double");
+   test<long double>("long double");
+}
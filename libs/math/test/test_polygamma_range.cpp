@@ -0,0 +1,227 @@
+#define BOOST_TEST_MAIN
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/math/special_functions/polygamma.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <limits>
+#include <vector>
+
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<50>, boost::multiprecision::et_off> cpp_bin_float_50_noet;
+
+// Arguments in every region of polygamma_imp: near zero, either side of
+// zero, the Euler-Maclaurin transition, and the asymptotic series, in an
+// order that makes the batch extend its coefficients more than once.
+template <class T>
+std::vector<T> range_arguments(const bool with_negative)
+{
+   std::vector<T> x;
+
+   x.push_back(T(450));
+   x.push_back(T(0.375));
+   x.push_back(T(1));
+   x.push_back(T(0.0625));
+   x.push_back(T(3.25));
+   x.push_back(T(0.001953125));
+   x.push_back(T(17.5));
+   x.push_back(T(0.4921875));
+   x.push_back(T(399.75));
+   x.push_back(T(1024.125));
+   x.push_back(T(0.5));
+   x.push_back(T(400));
+   x.push_back(T(-0.25));
+   x.push_back(T(-0.4375));
+
+   if(with_negative)
+   {
+      // Only digamma takes arguments beyond the series near zero.
+      x.push_back(T(-2.5));
+      x.push_back(T(-7.75));
+      x.push_back(T(-40.125));
+   }
+
+   return x;
+}
+
+// Over a range, each value must be exactly the scalar one.
+template <class T>
+void test_range(const char* name)
+{
+   std::cout << "Testing type " << name << ":\n";
+
+   static const int orders[] = { 0, 1, 2, 3, 4, 7, 12, 30 };
+
+   for(unsigned i = 0; i < sizeof(orders) / sizeof(orders[0]); ++i)
+   {
+      const int n = orders[i];
+
+      const std::vector<T> x = range_arguments<T>(n == 0);
+      std::vector<T>       pg(x.size());
+
+      const typename std::vector<T>::iterator end = boost::math::polygamma(n, x.begin(), x.end(), pg.begin());
+
+      BOOST_CHECK(end == pg.end());
+
+      for(unsigned j = 0; j < x.size(); ++j)
+      {
+         BOOST_CHECK_EQUAL(pg[j], boost::math::polygamma(n, x[j]));
+      }
+   }
+
+   const std::vector<T> x = range_arguments<T>(true);
+   std::vector<T>       dg(x.size());
+   std::vector<T>       tg(x.size());
+
+   boost::math::digamma(x.begin(), x.end(), dg.begin());
+   boost::math::trigamma(x.begin(), x.end() - 3, tg.begin());
+
+   for(unsigned j = 0; j < x.size(); ++j)
+   {
+      BOOST_CHECK_EQUAL(dg[j], boost::math::polygamma(0, x[j]));
+   }
+
+   for(unsigned j = 0; j + 3 < x.size(); ++j)
+   {
+      BOOST_CHECK_EQUAL(tg[j], boost::math::trigamma(x[j]));
+   }
+
+   // An empty range writes nothing.
+   BOOST_CHECK(boost::math::polygamma(1, x.begin(), x.begin(), tg.begin()) == tg.begin());
+}
+
+// Known values of digamma, which the range overloads share with polygamma.
+template <class T>
+void test_digamma_values(const char* name)
+{
+   std::cout << "Testing digamma for type " << name << ":\n";
+
+   static const T x[] =
+   {
+      T(1), T(0.5), T(0.25), T(2), T(-0.75), T(0.001953125), T(10)
+   };
+
+   // -gamma, -gamma - 2 log(2), -gamma - pi / 2 - 3 log(2), 1 - gamma,
+   // psi(7/4) - pi, and N[PolyGamma[0, {2^-9, 10}], 40].
+   static const T data[] =
+   {
+      T(-0.5772156649015328606065120900824024310422L),
+      T(-1.963510026021423479440976332998755567193L),
+      T(-4.227453533376265408089530146096683577367L),
+      T(0.4227843350984671393934879099175975689578L),
+      T(-2.894120200042932074756196812763350244034L),
+      T(-512.5740074804865254682473274959275018157L),
+      T(2.251752589066721107647456163885851537212L)
+   };
+
+   std::vector<T> dg(sizeof(x) / sizeof(x[0]));
+
+   boost::math::digamma(x, x + dg.size(), dg.begin());
+
+   T tol = boost::math::tools::epsilon<T>() * 20;
+   for(unsigned i = 0; i < dg.size(); ++i)
+   {
+      BOOST_CHECK_CLOSE_FRACTION(boost::math::polygamma(0, x[i]), data[i], tol);
+      BOOST_CHECK_CLOSE_FRACTION(dg[i], data[i], tol);
+   }
+}
+
+// float and double go through the block kernel, a block at a time,
+// which agrees with the scalar function to within (8 + n / 3) eps; for
+// digamma, absolutely where |psi| < 1, since around its root at 1.4616
+// the shifted sum cancels. The arguments that the kernel can't take fall
+// back to the scalar series, and must match the scalar function exactly,
+// as must the padded short final block.
+template <class T>
+void test_kernel(const char* name)
+{
+   std::cout << "Testing kernel for type " << name << ":\n";
+
+   static const int orders[] = { 0, 1, 2, 3, 5, 10, 20, 40, 80, 120 };
+
+   for(unsigned i = 0; i < sizeof(orders) / sizeof(orders[0]); ++i)
+   {
+      const int n = orders[i];
+
+      // 37 arguments: two full blocks and a short one.
+      std::vector<T> x;
+
+      for(int j = 1; j <= 30; ++j)
+      {
+         x.push_back(T(j * j) / 2.75F);
+      }
+
+      x.push_back(T(0.0078125));
+      x.push_back(T(399.5));
+      x.push_back(T(1000.25));
+      x.push_back(T(1));
+      x.push_back(T(0.5));
+      x.push_back(T(0.25));
+      x.push_back(T(3.125));
+
+      // Outside the domain of the kernel, mixed into the blocks.
+      x[3] = T(0);
+      x[9] = T(-0.25);
+      x[17] = std::numeric_limits<T>::quiet_NaN();
+      x[18] = std::numeric_limits<T>::infinity();
+      x[20] = ((n == 0) ? T(-2.5) : T(-0.4375));
+      x[29] = (boost::math::tools::max_value<T>)();
+
+      if(n == 0)
+      {
+         // A pole of digamma.
+         x[3] = T(0.75);
+      }
+
+      std::vector<T> pg(x.size());
+
+      BOOST_CHECK(boost::math::polygamma(n, x.begin(), x.end(), pg.begin()) == pg.end());
+
+      typedef typename boost::math::promoteftod<T>::type kernel_value_type;
+
+      const boost::math::detail::polygamma_shifted_asymptotic<kernel_value_type> kernel(n);
+
+      const T tol = boost::math::tools::epsilon<T>() * (8 + (n / 3));
+
+      for(unsigned j = 0; j < x.size(); ++j)
+      {
+         const T pg_scalar = boost::math::polygamma(n, x[j]);
+
+         if(!kernel.accepts(kernel_value_type(x[j])))
+         {
+            BOOST_CHECK((pg[j] == pg_scalar) || ((boost::math::isnan)(pg[j]) && (boost::math::isnan)(pg_scalar)));
+         }
+         else if((boost::math::isfinite)(pg_scalar) && (pg_scalar != 0))
+         {
+            const T pg_reference = static_cast<T>(boost::math::polygamma(n, static_cast<long double>(x[j])));
+
+            if((n == 0) && (pg_reference > -1) && (pg_reference < 1))
+            {
+               BOOST_CHECK_SMALL(T(pg[j] - pg_reference), tol);
+            }
+            else
+            {
+               BOOST_CHECK_CLOSE_FRACTION(pg[j], pg_reference, tol);
+            }
+         }
+      }
+
+      // A single argument is a short block on its own.
+      T pg_one;
+      boost::math::polygamma(n, &x[35], &x[35] + 1, &pg_one);
+      BOOST_CHECK_EQUAL(pg_one, pg[35]);
+   }
+}
+
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test_range<long double>("long double");
+   test_range<cpp_bin_float_50_noet>("cpp_bin_float_50");
+
+   test_kernel<float>("float");
+   test_kernel<double>("double");
+
+   test_digamma_values<double>("double");
+   test_digamma_values<long double>("long double");
+}
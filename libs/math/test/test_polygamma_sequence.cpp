@@ -0,0 +1,82 @@
+#define BOOST_TEST_MAIN
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/polygamma.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <vector>
+
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<50>, boost::multiprecision::et_off> cpp_bin_float_50_noet;
+
+// polygamma_sequence(n_max, x) against polygamma(m, x) for every order m,
+// digamma included. The orders share one shift of x, long enough for
+// n_max, which costs digamma a few digits as log(x + N) and the shifted
+// sum cancel: it is held to 40 eps, the other orders to 10 eps. For
+// x <= 0 each order is the scalar value itself.
+template <class T>
+void test(const char* name)
+{
+   std::cout << "Testing type " << name << ":\n";
+
+   static const int n_max[] = { 0, 1, 4, 10, 25 };
+
+   static const T x[] =
+   {
+      T(0.001953125), T(0.25), T(0.4375), T(0.75), T(1), T(3.5), T(17.25), T(399.5), T(400.5), T(1200)
+   };
+
+   static const T x_non_positive[] =
+   {
+      T(-0.25), T(-0.4375)
+   };
+
+   for(unsigned i = 0; i < sizeof(n_max) / sizeof(n_max[0]); ++i)
+   {
+      std::vector<T> pg(n_max[i] + 1);
+
+      for(unsigned j = 0; j < sizeof(x) / sizeof(x[0]); ++j)
+      {
+         BOOST_CHECK(boost::math::polygamma_sequence(n_max[i], x[j], pg.begin()) == pg.end());
+
+         for(int m = 0; m <= n_max[i]; ++m)
+         {
+            const T tol       = boost::math::tools::epsilon<T>() * ((m == 0) ? 40 : 10);
+            const T pg_scalar = boost::math::polygamma(m, x[j]);
+
+            if((boost::math::isfinite)(pg_scalar))
+            {
+               BOOST_CHECK_CLOSE_FRACTION(pg[m], pg_scalar, tol);
+            }
+            else
+            {
+               // Past the range of float near zero.
+               BOOST_CHECK_EQUAL(pg[m], pg_scalar);
+            }
+         }
+      }
+
+      for(unsigned j = 0; j < sizeof(x_non_positive) / sizeof(x_non_positive[0]); ++j)
+      {
+         boost::math::polygamma_sequence(n_max[i], x_non_positive[j], pg.begin());
+
+         for(int m = 0; m <= n_max[i]; ++m)
+         {
+            BOOST_CHECK_EQUAL(pg[m], boost::math::polygamma(m, x_non_positive[j]));
+         }
+      }
+   }
+
+   // No orders, no output.
+   std::vector<T> pg(1, T(0));
+   BOOST_CHECK(boost::math::polygamma_sequence(-1, T(2), pg.begin()) == pg.begin());
+}
+
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test<float>("float");
+   test<double>("double");
+   test<long double>("long double");
+   test<cpp_bin_float_50_noet>("cpp_bin_float_50");
+}
@@ -0,0 +1,84 @@
+#define BOOST_TEST_MAIN
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/math/special_functions/detail/zeta_integer_values.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+typedef boost::multiprecision::number<boost::multiprecision::cpp_bin_float<50>, boost::multiprecision::et_off> cpp_bin_float_50_noet;
+
+#define SC_(x) BOOST_STRINGIZE(x)
+
+// The cached values of zeta at the integers, which polygamma takes near
+// zero, against known values: from the Bernoulli numbers and from zeta
+// at small m, and from the direct sum at large m, where the switch
+// between them depends on the precision of T.
+template <class T>
+void test(const char* name)
+{
+   std::cout << "Testing type " << name << ":\n";
+
+   /* N[Table[Zeta[m], {m, {2, 3, ..., 150}}], 60] */
+   static const unsigned m[] =
+   {
+      2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 17, 20, 25, 28, 29, 33, 40, 50, 64, 100, 150
+   };
+
+   static const char* data[] =
+   {
+      SC_(1.64493406684822643647241516664602518921894990120679843773556),
+      SC_(1.20205690315959428539973816151144999076498629234049888179227),
+      SC_(1.08232323371113819151600369654116790277475095191872690768298),
+      SC_(1.03692775514336992633136548645703416805708091950191281197419),
+      SC_(1.01734306198444913971451792979092052790181749003285356184241),
+      SC_(1.00834927738192282683979754984979675959986356056523870641728),
+      SC_(1.00407735619794433937868523850865246525896079064985002032911),
+      SC_(1.00200839282608221441785276923241206048560585139488875654860),
+      SC_(1.00099457512781808533714595890031901700601953156447751725779),
+      SC_(1.00049418860411946455870228252646993646860643575820861711914),
+      SC_(1.00024608655330804829863799804773967096041608845800340453304),
+      SC_(1.00012271334757848914675183652635739571427510589550984513670),
+      SC_(1.00000763719763789976227360029356302921308824909026267909538),
+      SC_(1.00000095396203387279611315203868344934594379418741059575006),
+      SC_(1.00000002980350351465228018606370506936601184473091954331240),
+      SC_(1.00000000372533402478845705481920401840242323289305929581152),
+      SC_(1.00000000186265972351304900640390994541694806166533046920067),
+      SC_(1.00000000011641550172700519775929738354563095165224717276359),
+      SC_(1.00000000000090949478402638892825331183869490875386000099088),
+      SC_(1.00000000000000088817842109308159030960913863913863256088715),
+      SC_(1.00000000000000000005421010862456645410918700404388633715063),
+      SC_(1.00000000000000000000000000000078886090522101180735205378277),
+      SC_(1.00000000000000000000000000000000000000000000070064923216241)
+   };
+
+   static const unsigned table_size = sizeof(m) / sizeof(m[0]);
+
+   boost::math::detail::zeta_integer_values_cache<T>& cache = boost::math::detail::get_zeta_integer_values_cache<T>();
+
+   // A short table first, so that the rest is found by growing it.
+   const T* zeta = cache.values(8U);
+
+   BOOST_CHECK_EQUAL(zeta[0], T(-0.5F));
+   BOOST_CHECK_CLOSE_FRACTION(zeta[2], boost::lexical_cast<T>(data[0]), boost::math::tools::epsilon<T>() * 4);
+
+   zeta = cache.values(m[table_size - 1] + 1U);
+
+   T tol = boost::math::tools::epsilon<T>() * 4;
+   for(unsigned i = 0; i < table_size; ++i)
+   {
+      BOOST_CHECK_CLOSE_FRACTION(zeta[m[i]], boost::lexical_cast<T>(data[i]), tol);
+   }
+
+   // Asking for fewer leaves what is there.
+   BOOST_CHECK(cache.values(4U) == zeta);
+}
+
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+   test<float>("float");
+   test<double>("double");
+   test<long double>("long double");
+   test<cpp_bin_float_50_noet>("cpp_bin_float_50");
+}